@@ -0,0 +1,21 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <tuple>
+
+
+template <int i>
+struct x { int value; };
+
+int main() {
+    std::tuple<
+        <%= (0...200).map { |n| "x<#{n}>" }.join(', ') %>
+    > tuple{};
+
+    int sum = 0;
+    <% (0...input_size).each do |n| %>
+        sum += std::get<<%= (n * 7) % 200 %>>(tuple).value;
+    <% end %>
+    return sum;
+}
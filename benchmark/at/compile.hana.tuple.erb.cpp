@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { int value; };
+
+int main() {
+    hana::tuple<
+        <%= (0...input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    > tuple{};
+
+    int sum = 0;
+    <% (0...input_size).each do |n| %>
+        sum += hana::at_c<<%= n %>>(tuple).value;
+    <% end %>
+    return sum;
+}
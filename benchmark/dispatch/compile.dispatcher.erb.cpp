@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/dispatcher.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+
+template <int i>
+struct x { char c[i]; };
+
+struct kernel {
+    template <typename T, typename N>
+    long operator()(T, N, long value) const
+    { return value * sizeof(typename T::type) + N::value; }
+};
+
+int main() {
+    auto dispatch = boost::hana::experimental::make_dispatcher<long(long)>(
+        boost::hana::make_tuple(
+            boost::hana::tuple_t<
+                <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+            >,
+            boost::hana::range_c<int, 0, 4>
+        ),
+        kernel{}
+    );
+
+    long result = dispatch(dispatch.key(<%= input_size - 1 %>, 3), 1);
+    (void)result;
+}
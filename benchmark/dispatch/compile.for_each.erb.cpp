@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+
+template <int i>
+struct x { char c[i]; };
+
+struct kernel {
+    template <typename T, typename N>
+    long operator()(T, N, long value) const
+    { return value * sizeof(typename T::type) + N::value; }
+};
+
+template <typename Types, typename Ns>
+long dispatch(Types const& types, Ns const& ns, int i, int j, long value) {
+    long result = 0;
+    int ti = 0;
+    boost::hana::for_each(types, [&](auto t) {
+        int ni = 0;
+        boost::hana::for_each(ns, [&](auto n) {
+            if (ti == i && ni == j)
+                result = kernel{}(t, n, value);
+            ++ni;
+        });
+        ++ti;
+    });
+    return result;
+}
+
+int main() {
+    auto types = boost::hana::tuple_t<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >;
+    auto ns = boost::hana::range_c<int, 0, 4>;
+
+    long result = dispatch(types, ns, <%= input_size - 1 %>, 3, 1);
+    (void)result;
+}
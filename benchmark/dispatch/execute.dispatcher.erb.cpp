@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/dispatcher.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+template <int i>
+struct x { char c[i]; };
+
+struct kernel {
+    template <typename T, typename N>
+    long operator()(T, N, long value) const
+    { return value * sizeof(typename T::type) + N::value; }
+};
+
+int main() {
+    auto dispatch = boost::hana::experimental::make_dispatcher<long(long)>(
+        boost::hana::make_tuple(
+            boost::hana::tuple_t<
+                <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+            >,
+            boost::hana::range_c<int, 0, 4>
+        ),
+        kernel{}
+    );
+
+    int i[1 << 10], j[1 << 10];
+    for (int n = 0; n < 1 << 10; ++n) {
+        i[n] = std::rand() % <%= input_size %>;
+        j[n] = std::rand() % 4;
+    }
+
+    boost::hana::benchmark::measure([&] {
+        long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            result += dispatch(dispatch.key(i[iteration], j[iteration]), iteration);
+        }
+        volatile long sink = result;
+        (void)sink;
+    });
+}
@@ -0,0 +1,59 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+template <int i>
+struct x { char c[i]; };
+
+struct kernel {
+    template <typename T, typename N>
+    long operator()(T, N, long value) const
+    { return value * sizeof(typename T::type) + N::value; }
+};
+
+template <typename Types, typename Ns>
+long dispatch(Types const& types, Ns const& ns, int i, int j, long value) {
+    long result = 0;
+    int ti = 0;
+    boost::hana::for_each(types, [&](auto t) {
+        int ni = 0;
+        boost::hana::for_each(ns, [&](auto n) {
+            if (ti == i && ni == j)
+                result = kernel{}(t, n, value);
+            ++ni;
+        });
+        ++ti;
+    });
+    return result;
+}
+
+int main() {
+    auto types = boost::hana::tuple_t<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >;
+    auto ns = boost::hana::range_c<int, 0, 4>;
+
+    int i[1 << 10], j[1 << 10];
+    for (int n = 0; n < 1 << 10; ++n) {
+        i[n] = std::rand() % <%= input_size %>;
+        j[n] = std::rand() % 4;
+    }
+
+    boost::hana::benchmark::measure([&] {
+        long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            result += dispatch(types, ns, i[iteration], j[iteration], iteration);
+        }
+        volatile long sink = result;
+        (void)sink;
+    });
+}
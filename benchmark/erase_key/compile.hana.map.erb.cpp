@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+namespace hana = boost::hana;
+
+
+struct undefined { };
+
+int main() {
+    constexpr auto map0 = hana::make_map();
+
+    <% (1..input_size).each do |n| %>
+        constexpr auto map<%= n %> = hana::insert(map<%= n - 1 %>,
+            hana::make_pair(hana::int_c<<%= n %>>, undefined{}));
+    <% end %>
+
+    constexpr auto erased0 = map<%= input_size %>;
+
+    <% (1..input_size).each do |n| %>
+        constexpr auto erased<%= n %> = hana::erase_key(erased<%= n - 1 %>, hana::int_c<<%= n %>>);
+    <% end %>
+
+    (void)erased<%= input_size %>;
+}
@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/set.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    constexpr auto set0 = hana::make_set();
+
+    <% (1..input_size).each do |n| %>
+        constexpr auto set<%= n %> = hana::insert(set<%= n - 1 %>, hana::int_c<<%= n %>>);
+    <% end %>
+
+    constexpr auto erased0 = set<%= input_size %>;
+
+    <% (1..input_size).each do |n| %>
+        constexpr auto erased<%= n %> = hana::erase_key(erased<%= n - 1 %>, hana::int_c<<%= n %>>);
+    <% end %>
+
+    (void)erased<%= input_size %>;
+}
@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+
+template <typename>
+struct is_last;
+
+template <int i>
+struct is_last<x<i>> : std::integral_constant<bool, i == <%= input_size %>> { };
+
+int main() {
+    constexpr auto types = hana::experimental::types<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >{};
+    constexpr auto result = hana::find_if(types, hana::trait<is_last>);
+    (void)result;
+}
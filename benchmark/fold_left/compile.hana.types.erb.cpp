@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <typename State, typename X>
+struct f { using type = X; };
+
+struct state;
+
+template <int> struct x;
+
+int main() {
+    constexpr auto types = hana::experimental::types<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >{};
+    constexpr auto result = hana::fold_left(types, hana::type_c<state>,
+                                                   hana::metafunction<f>);
+    (void)result;
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/ext/std/integer_sequence.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/maximum.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/sum.hpp>
+#include <boost/hana/unique.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct is_odd {
+    template <typename X>
+    constexpr auto operator()(X const&) const
+    { return hana::bool_c<(X::value % 2 != 0)>; }
+};
+
+int main() {
+    constexpr std::integer_sequence<int,
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size)).map { |n|
+            n / 2
+        }.join(', ') %>
+    > values{};
+
+    constexpr auto sorted = hana::unique(hana::sort(values));
+    constexpr auto reversed = hana::reverse(sorted);
+    constexpr auto odds = hana::filter(reversed, is_odd{});
+    constexpr auto sum = hana::sum<>(odds);
+    constexpr auto max = hana::maximum(values);
+    constexpr auto found = hana::contains(values, hana::int_c<<%= input_size / 4 %>>);
+    (void)sum; (void)max; (void)found;
+}
@@ -0,0 +1,96 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/keys.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, last_name),
+        (int, age),
+        (Car, car)
+    );
+};
+
+// Same as in example/misc/from_json.cpp
+template <typename T>
+  std::enable_if_t<std::is_same<T, int>::value,
+T> from_json(std::istream& in) {
+    T result;
+    in >> result;
+    return result;
+}
+
+template <typename T>
+  std::enable_if_t<std::is_same<T, std::string>::value,
+T> from_json(std::istream& in) {
+    char quote;
+    in >> quote;
+
+    T result;
+    char c;
+    while (in.get(c) && c != '"') {
+        result += c;
+    }
+    return result;
+}
+
+template <typename T>
+  std::enable_if_t<hana::Struct<T>::value,
+T> from_json(std::istream& in) {
+    T result;
+    char brace;
+    in >> brace;
+
+    hana::for_each(hana::keys(result), [&](auto key) {
+        in.ignore(std::numeric_limits<std::streamsize>::max(), ':');
+        auto& member = hana::at_key(result, key);
+        using Member = std::remove_reference_t<decltype(member)>;
+        member = from_json<Member>(in);
+    });
+    in >> brace;
+    return result;
+}
+
+int main () {
+    std::vector<Person> people(<%= input_size %>);
+    for (Person& p : people) {
+        p.name = "John";
+        p.last_name = "Doe";
+        p.age = std::rand() % 100;
+        p.car = {"BMW", "Z3"};
+    }
+    std::string json;
+    for (Person const& p : people)
+        hana::experimental::to_json(p, json);
+
+    std::vector<Person> result(people.size());
+    boost::hana::benchmark::measure([&] {
+        std::istringstream in(json);
+        for (Person& p : result)
+            p = from_json<Person>(in);
+    });
+}
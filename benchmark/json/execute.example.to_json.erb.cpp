@@ -0,0 +1,79 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/fold.hpp>
+#include <boost/hana/functional/placeholder.hpp>
+#include <boost/hana/intersperse.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/transform.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, last_name),
+        (int, age),
+        (Car, car)
+    );
+};
+
+// Same as in example/tutorial/introspection.json.cpp
+template <typename Xs>
+std::string join(Xs&& xs, std::string sep) {
+    return hana::fold(hana::intersperse(std::forward<Xs>(xs), sep), "", hana::_ + hana::_);
+}
+
+std::string quote(std::string s) { return "\"" + s + "\""; }
+
+template <typename T>
+auto to_json(T const& x) -> decltype(std::to_string(x)) {
+    return std::to_string(x);
+}
+
+std::string to_json(std::string s) { return quote(s); }
+
+template <typename T>
+  std::enable_if_t<hana::Struct<T>::value,
+std::string> to_json(T const& x) {
+    auto json = hana::transform(hana::keys(x), [&](auto name) {
+        auto const& member = hana::at_key(x, name);
+        return quote(hana::to<char const*>(name)) + " : " + to_json(member);
+    });
+
+    return "{" + join(std::move(json), ", ") + "}";
+}
+
+int main () {
+    std::vector<Person> people(<%= input_size %>);
+    for (Person& p : people) {
+        p.name = "John";
+        p.last_name = "Doe";
+        p.age = std::rand() % 100;
+        p.car = {"BMW", "Z3"};
+    }
+
+    std::string out;
+    boost::hana::benchmark::measure([&] {
+        out.clear();
+        for (Person const& p : people)
+            out += to_json(p);
+    });
+}
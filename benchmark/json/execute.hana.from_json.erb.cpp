@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, last_name),
+        (int, age),
+        (Car, car)
+    );
+};
+
+int main () {
+    std::vector<Person> people(<%= input_size %>);
+    for (Person& p : people) {
+        p.name = "John";
+        p.last_name = "Doe";
+        p.age = std::rand() % 100;
+        p.car = {"BMW", "Z3"};
+    }
+    std::string json;
+    for (Person const& p : people)
+        boost::hana::experimental::to_json(p, json);
+
+    std::vector<Person> result(people.size());
+    boost::hana::benchmark::measure([&] {
+        char const* in = json.data();
+        for (Person& p : result)
+            in = boost::hana::experimental::from_json(p, in, json.data() + json.size());
+    });
+}
@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/printable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <string>
+
+
+int main () {
+    auto nested = boost::hana::make_tuple(
+        <%= (1..input_size).map { |i|
+            "boost::hana::make_tuple(#{i}, 'x', boost::hana::just(#{i}.5), " +
+            "boost::hana::make_map(boost::hana::make_pair(boost::hana::int_c<#{i}>, \"value\")))"
+        }.join(', ') %>
+    );
+
+    std::string out;
+    boost::hana::benchmark::measure([&] {
+        out = boost::hana::experimental::print(nested);
+    });
+}
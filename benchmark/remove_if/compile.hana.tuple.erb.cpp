@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/remove_if.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+struct is_even {
+    template <typename N>
+    constexpr auto operator()(N) const
+    { return hana::bool_c<N::value % 2 == 0>; }
+};
+
+int main() {
+    constexpr auto tuple = hana::make_tuple(
+        <%= (1..input_size).map { |n| "hana::int_c<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = hana::remove_if(tuple, is_even{});
+    (void)result;
+}
@@ -0,0 +1,19 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/scan_left.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+struct f {
+    constexpr int operator()(int state, int x) const { return state + x; }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "#{n}" }.join(', ') %>
+    );
+    constexpr auto result = boost::hana::scan_left(tuple, 0, f{});
+    (void)result;
+}
@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (double, x),
+        (double, y)
+    );
+};
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (Point, position),
+        (boost::hana::tuple<int, float>, extra),
+        (std::array<short, 4>, flags),
+        (std::vector<int>, tags)
+    );
+};
+
+int main () {
+    std::vector<Record> records(<%= input_size %>);
+    for (Record& r : records) {
+        r.id = std::rand();
+        r.position = {std::rand() / 2.0, std::rand() / 3.0};
+        r.flags = {{1, 2, 3, 4}};
+        r.tags.assign(std::rand() % 8, std::rand());
+    }
+    std::vector<char> buffer(<%= input_size %> * 128);
+    char* end = buffer.data();
+    for (Record const& r : records)
+        end = boost::hana::experimental::serialize(r, end, buffer.data() + buffer.size());
+
+    std::vector<Record> result(records.size());
+    boost::hana::benchmark::measure([&] {
+        char const* in = buffer.data();
+        for (Record& r : result)
+            in = boost::hana::experimental::deserialize(r, in, end);
+    });
+}
@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (double, x),
+        (double, y)
+    );
+};
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (Point, position),
+        (boost::hana::tuple<int, float>, extra),
+        (std::array<short, 4>, flags),
+        (std::vector<int>, tags)
+    );
+};
+
+int main () {
+    std::vector<Record> records(<%= input_size %>);
+    for (Record& r : records) {
+        r.id = std::rand();
+        r.position = {std::rand() / 2.0, std::rand() / 3.0};
+        r.flags = {{1, 2, 3, 4}};
+        r.tags.assign(std::rand() % 8, std::rand());
+    }
+    std::vector<char> buffer(<%= input_size %> * 128);
+
+    boost::hana::benchmark::measure([&] {
+        char* out = buffer.data();
+        char* last = buffer.data() + buffer.size();
+        for (Record const& r : records)
+            out = boost::hana::experimental::serialize(r, out, last);
+    });
+}
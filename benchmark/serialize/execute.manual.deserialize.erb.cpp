@@ -0,0 +1,91 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+
+struct Point {
+    double x;
+    double y;
+};
+
+struct Extra {
+    int a;
+    float b;
+};
+
+struct Record {
+    int id;
+    Point position;
+    Extra extra;
+    std::array<short, 4> flags;
+    std::vector<int> tags;
+};
+
+char* serialize(Record const& r, char* out, char* last) {
+    std::size_t size = sizeof(int) + 2 * sizeof(double) + sizeof(int) + sizeof(float)
+                     + 4 * sizeof(short) + sizeof(std::uint64_t)
+                     + r.tags.size() * sizeof(int);
+    if (static_cast<std::size_t>(last - out) < size)
+        return nullptr;
+
+    std::memcpy(out, &r.id, sizeof(int));                   out += sizeof(int);
+    std::memcpy(out, &r.position.x, sizeof(double));        out += sizeof(double);
+    std::memcpy(out, &r.position.y, sizeof(double));        out += sizeof(double);
+    std::memcpy(out, &r.extra.a, sizeof(int));              out += sizeof(int);
+    std::memcpy(out, &r.extra.b, sizeof(float));            out += sizeof(float);
+    std::memcpy(out, r.flags.data(), 4 * sizeof(short));    out += 4 * sizeof(short);
+    std::uint64_t n = r.tags.size();
+    std::memcpy(out, &n, sizeof n);                         out += sizeof n;
+    std::memcpy(out, r.tags.data(), n * sizeof(int));       out += n * sizeof(int);
+    return out;
+}
+
+char const* deserialize(Record& r, char const* in, char const* last) {
+    std::size_t fixed = sizeof(int) + 2 * sizeof(double) + sizeof(int) + sizeof(float)
+                      + 4 * sizeof(short) + sizeof(std::uint64_t);
+    if (static_cast<std::size_t>(last - in) < fixed)
+        return nullptr;
+
+    std::memcpy(&r.id, in, sizeof(int));                    in += sizeof(int);
+    std::memcpy(&r.position.x, in, sizeof(double));         in += sizeof(double);
+    std::memcpy(&r.position.y, in, sizeof(double));         in += sizeof(double);
+    std::memcpy(&r.extra.a, in, sizeof(int));               in += sizeof(int);
+    std::memcpy(&r.extra.b, in, sizeof(float));             in += sizeof(float);
+    std::memcpy(r.flags.data(), in, 4 * sizeof(short));     in += 4 * sizeof(short);
+    std::uint64_t n;
+    std::memcpy(&n, in, sizeof n);                          in += sizeof n;
+    if (n > static_cast<std::size_t>(last - in) / sizeof(int))
+        return nullptr;
+    r.tags.resize(n);
+    std::memcpy(r.tags.data(), in, n * sizeof(int));        in += n * sizeof(int);
+    return in;
+}
+
+int main () {
+    std::vector<Record> records(<%= input_size %>);
+    for (Record& r : records) {
+        r.id = std::rand();
+        r.position = {std::rand() / 2.0, std::rand() / 3.0};
+        r.flags = {{1, 2, 3, 4}};
+        r.tags.assign(std::rand() % 8, std::rand());
+    }
+    std::vector<char> buffer(<%= input_size %> * 128);
+    char* end = buffer.data();
+    for (Record const& r : records)
+        end = serialize(r, end, buffer.data() + buffer.size());
+
+    std::vector<Record> result(records.size());
+    boost::hana::benchmark::measure([&] {
+        char const* in = buffer.data();
+        for (Record& r : result)
+            in = deserialize(r, in, end);
+    });
+}
@@ -0,0 +1,67 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+
+struct Point {
+    double x;
+    double y;
+};
+
+struct Extra {
+    int a;
+    float b;
+};
+
+struct Record {
+    int id;
+    Point position;
+    Extra extra;
+    std::array<short, 4> flags;
+    std::vector<int> tags;
+};
+
+char* serialize(Record const& r, char* out, char* last) {
+    std::size_t size = sizeof(int) + 2 * sizeof(double) + sizeof(int) + sizeof(float)
+                     + 4 * sizeof(short) + sizeof(std::uint64_t)
+                     + r.tags.size() * sizeof(int);
+    if (static_cast<std::size_t>(last - out) < size)
+        return nullptr;
+
+    std::memcpy(out, &r.id, sizeof(int));                   out += sizeof(int);
+    std::memcpy(out, &r.position.x, sizeof(double));        out += sizeof(double);
+    std::memcpy(out, &r.position.y, sizeof(double));        out += sizeof(double);
+    std::memcpy(out, &r.extra.a, sizeof(int));              out += sizeof(int);
+    std::memcpy(out, &r.extra.b, sizeof(float));            out += sizeof(float);
+    std::memcpy(out, r.flags.data(), 4 * sizeof(short));    out += 4 * sizeof(short);
+    std::uint64_t n = r.tags.size();
+    std::memcpy(out, &n, sizeof n);                         out += sizeof n;
+    std::memcpy(out, r.tags.data(), n * sizeof(int));       out += n * sizeof(int);
+    return out;
+}
+
+int main () {
+    std::vector<Record> records(<%= input_size %>);
+    for (Record& r : records) {
+        r.id = std::rand();
+        r.position = {std::rand() / 2.0, std::rand() / 3.0};
+        r.flags = {{1, 2, 3, 4}};
+        r.tags.assign(std::rand() % 8, std::rand());
+    }
+    std::vector<char> buffer(<%= input_size %> * 128);
+
+    boost::hana::benchmark::measure([&] {
+        char* out = buffer.data();
+        char* last = buffer.data() + buffer.size();
+        for (Record const& r : records)
+            out = serialize(r, out, last);
+    });
+}
@@ -0,0 +1,82 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/members.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (double, x),
+        (double, y)
+    );
+};
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (Point, position),
+        (boost::hana::tuple<int, float>, extra),
+        (std::array<short, 4>, flags),
+        (std::vector<int>, tags)
+    );
+};
+
+void write(std::ostream& out, int x) { out << x << ' '; }
+void write(std::ostream& out, short x) { out << x << ' '; }
+void write(std::ostream& out, float x) { out << x << ' '; }
+void write(std::ostream& out, double x) { out << x << ' '; }
+
+template <typename T>
+void write(std::ostream& out, std::vector<T> const& xs) {
+    out << xs.size() << ' ';
+    for (auto const& x : xs)
+        write(out, x);
+}
+
+template <typename T, std::size_t N>
+void write(std::ostream& out, std::array<T, N> const& xs) {
+    for (auto const& x : xs)
+        write(out, x);
+}
+
+template <typename ...T>
+void write(std::ostream& out, boost::hana::tuple<T...> const& xs) {
+    boost::hana::for_each(xs, [&](auto const& x) {
+        write(out, x);
+    });
+}
+
+template <typename T>
+void write(std::ostream& out, T const& x) {
+    boost::hana::for_each(boost::hana::members(x), [&](auto const& member) {
+        write(out, member);
+    });
+}
+
+int main () {
+    std::vector<Record> records(<%= input_size %>);
+    for (Record& r : records) {
+        r.id = std::rand();
+        r.position = {std::rand() / 2.0, std::rand() / 3.0};
+        r.flags = {{1, 2, 3, 4}};
+        r.tags.assign(std::rand() % 8, std::rand());
+    }
+    std::vector<char> buffer(<%= input_size %> * 128);
+
+    boost::hana::benchmark::measure([&] {
+        std::ostringstream out;
+        for (Record const& r : records)
+            write(out, r);
+    });
+}
@@ -0,0 +1,64 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// This sorts by evaluating the predicate on every pair of elements into a
+// constexpr matrix of booleans, and then sorting the indices with a single
+// call to `detail::sort`. It requires O(n^2) instantiations of the predicate.
+template <std::size_t N>
+struct less_than {
+    bool const (&matrix)[N * N + 1];
+    constexpr bool operator()(std::size_t i, std::size_t j) const
+    { return matrix[i * N + j]; }
+};
+
+template <typename Xs, std::size_t N>
+struct matrix_sort {
+    template <std::size_t k>
+    static constexpr bool compare() {
+        return decltype(hana::less(hana::at_c<k / N>(std::declval<Xs>()),
+                                   hana::at_c<k % N>(std::declval<Xs>())))::value;
+    }
+
+    template <std::size_t ...k>
+    static constexpr auto compute(std::index_sequence<k...>) {
+        constexpr bool matrix[] = {compare<k>()..., false};
+        hana::detail::array<std::size_t, N> indices{};
+        for (std::size_t i = 0; i < N; ++i)
+            indices[i] = i;
+        hana::detail::sort(indices.begin(), indices.end(), less_than<N>{matrix});
+        return indices;
+    }
+
+    static constexpr auto indices = compute(std::make_index_sequence<N * N>{});
+};
+
+template <typename Xs, std::size_t ...i>
+constexpr auto sort_impl(Xs const& xs, std::index_sequence<i...>) {
+    using Indices = matrix_sort<Xs const&, sizeof...(i)>;
+    return hana::make_tuple(hana::at_c<Indices::indices[i]>(xs)...);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main() {
+    constexpr auto tuple = hana::make_tuple(
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size)).map { |n|
+            "hana::int_c<#{n}>"
+        }.join(', ') %>
+    );
+    constexpr auto result = sort_impl(tuple, std::make_index_sequence<<%= input_size %>>{});
+    (void)result;
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+
+template <typename, typename>
+struct less;
+
+template <int i, int j>
+struct less<x<i>, x<j>> : std::integral_constant<bool, (i < j)> { };
+
+int main() {
+    constexpr auto types = hana::experimental::types<
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size)).map { |n|
+            "x<#{n}>"
+        }.join(', ') %>
+    >{};
+    constexpr auto result = hana::sort(types, hana::trait<less>);
+    (void)result;
+}
@@ -0,0 +1,110 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// This is the recursive insertion sort that was previously used to
+// implement `hana::sort`; it is kept here for comparison purposes.
+template <typename Xs, typename Pred>
+struct sort_predicate {
+    template <std::size_t I, std::size_t J>
+    using apply = decltype(std::declval<Pred>()(
+        hana::at_c<I>(std::declval<Xs>()),
+        hana::at_c<J>(std::declval<Xs>())
+    ));
+};
+
+template <typename Pred, std::size_t Insert, bool IsInsertionPoint,
+          typename Left,
+          std::size_t ...Right>
+struct insert;
+
+template <
+    typename Pred, std::size_t Insert,
+    std::size_t ...Left,
+    std::size_t Right1, std::size_t Right2, std::size_t ...Right
+>
+struct insert<Pred, Insert, false,
+              std::index_sequence<Left...>,
+              Right1, Right2, Right...
+> {
+    using type = typename insert<
+        Pred, Insert, (bool)Pred::template apply<Insert, Right2>::value,
+        std::index_sequence<Left..., Right1>,
+        Right2, Right...
+    >::type;
+};
+
+template <typename Pred, std::size_t Insert, std::size_t ...Left, std::size_t Last>
+struct insert<Pred, Insert, false, std::index_sequence<Left...>, Last> {
+    using type = std::index_sequence<Left..., Last, Insert>;
+};
+
+template <typename Pred, std::size_t Insert, std::size_t ...Left, std::size_t ...Right>
+struct insert<Pred, Insert, true, std::index_sequence<Left...>, Right...> {
+    using type = std::index_sequence<Left..., Insert, Right...>;
+};
+
+template <typename Pred, typename Result, std::size_t ...T>
+struct insertion_sort_impl;
+
+template <typename Pred,
+          std::size_t Result1, std::size_t ...Result,
+          std::size_t T, std::size_t ...Ts>
+struct insertion_sort_impl<Pred, std::index_sequence<Result1, Result...>, T, Ts...> {
+    using type = typename insertion_sort_impl<
+        Pred,
+        typename insert<
+            Pred, T, (bool)Pred::template apply<T, Result1>::value,
+            std::index_sequence<>,
+            Result1, Result...
+        >::type,
+        Ts...
+    >::type;
+};
+
+template <typename Pred, std::size_t T, std::size_t ...Ts>
+struct insertion_sort_impl<Pred, std::index_sequence<>, T, Ts...> {
+    using type = typename insertion_sort_impl<
+        Pred, std::index_sequence<T>, Ts...
+    >::type;
+};
+
+template <typename Pred, typename Result>
+struct insertion_sort_impl<Pred, Result> {
+    using type = Result;
+};
+
+template <typename Xs, std::size_t ...i>
+constexpr auto unpack_indices(Xs const& xs, std::index_sequence<i...>)
+{ return hana::make_tuple(hana::at_c<i>(xs)...); }
+
+template <typename Xs, std::size_t ...i>
+constexpr auto sort_impl(Xs const& xs, std::index_sequence<i...>) {
+    using Indices = typename insertion_sort_impl<
+        sort_predicate<Xs const&, decltype(hana::less)>,
+        std::index_sequence<>, i...
+    >::type;
+    return unpack_indices(xs, Indices{});
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main() {
+    constexpr auto tuple = hana::make_tuple(
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size)).map { |n|
+            "hana::int_c<#{n}>"
+        }.join(', ') %>
+    );
+    constexpr auto result = sort_impl(tuple, std::make_index_sequence<<%= input_size %>>{});
+    (void)result;
+}
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/count_if.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+struct plus {
+    constexpr int operator()(int x, int y) const { return x + y; }
+};
+
+struct is_odd {
+    constexpr bool operator()(int x) const { return x % 2 != 0; }
+};
+
+int main() {
+    auto values = boost::hana::make_tuple(
+        <%= (1..input_size).to_a.join(', ') %>
+    );
+
+    int result = boost::hana::fold_left(values, 0, plus{});
+    boost::hana::for_each(values, [&](int x) { result += x; });
+    result += boost::hana::count_if(values, is_odd{});
+    result += boost::hana::any_of(values, is_odd{});
+    (void)result;
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/count_if.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include "measure.hpp"
+#include <array>
+#include <cstdlib>
+
+
+struct plus {
+    constexpr long long operator()(long long x, int y) const { return x + y; }
+};
+
+struct is_odd {
+    constexpr bool operator()(int x) const { return x % 2 != 0; }
+};
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::array<int, <%= input_size %>> values = {{
+                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+            }};
+
+            result += boost::hana::fold_left(values, 0ll, plus{});
+            boost::hana::for_each(values, [&](int x) { result ^= x; });
+            result += boost::hana::count_if(values, is_odd{});
+            result += boost::hana::any_of(values, is_odd{});
+        }
+        volatile long long sink = result;
+        (void)sink;
+    });
+}
@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/hash_value.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+struct S {
+    BOOST_HANA_DEFINE_STRUCT(S,
+        <%= (1..input_size).map { |i| "(int, m#{i})" }.join(', ') %>
+    );
+};
+
+int main () {
+    // Only the last member varies, so that not all the hashes are the same.
+    std::vector<S> values(1 << 10);
+    for (auto& s : values)
+        s.m<%= input_size %> = std::rand() % 2;
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t volatile result = 0;
+        for (std::size_t i = 0; i + 1 < values.size(); ++i)
+            result += boost::hana::experimental::hash_value(values[i]);
+    });
+}
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+struct S {
+    int <%= (1..input_size).map { |i| "m#{i} = 0" }.join(', ') %>;
+};
+
+bool operator==(S const& x, S const& y) {
+    return <%= (1..input_size).map { |i| "x.m#{i} == y.m#{i}" }.join(' && ') %>;
+}
+
+int main () {
+    // Only the last member differs, so that every member is compared.
+    std::vector<S> values(1 << 10);
+    for (auto& s : values)
+        s.m<%= input_size %> = std::rand() % 2;
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t volatile result = 0;
+        for (std::size_t i = 0; i + 1 < values.size(); ++i)
+            result += values[i] == values[i + 1];
+    });
+}
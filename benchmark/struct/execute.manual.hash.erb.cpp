@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+
+struct S {
+    int <%= (1..input_size).map { |i| "m#{i} = 0" }.join(', ') %>;
+};
+
+std::size_t hash(S const& x) {
+    std::size_t seed = 0;
+    <%= (1..input_size).map { |i| "seed ^= std::hash<int>{}(x.m#{i}) + 0x9e3779b9 + (seed << 6) + (seed >> 2);" }.join(' ') %>
+    return seed;
+}
+
+int main () {
+    // Only the last member varies, so that not all the hashes are the same.
+    std::vector<S> values(1 << 10);
+    for (auto& s : values)
+        s.m<%= input_size %> = std::rand() % 2;
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t volatile result = 0;
+        for (std::size_t i = 0; i + 1 < values.size(); ++i)
+            result += hash(values[i]);
+    });
+}
@@ -0,0 +1,58 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/transform.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+
+static long long allocations = 0;
+
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <typename U>
+    counting_allocator(counting_allocator<U> const&) { }
+
+    T* allocate(std::size_t n) {
+        ++allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    { std::allocator<T>{}.deallocate(p, n); }
+
+    template <typename U>
+    bool operator==(counting_allocator<U> const&) const { return true; }
+    template <typename U>
+    bool operator!=(counting_allocator<U> const&) const { return false; }
+};
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::vector<int, counting_allocator<int>> values = {
+                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+            };
+
+            auto results = boost::hana::transform(values, [&](int t) {
+                return result += t;
+            });
+            (void)results;
+        }
+
+        // One allocation for the input and one for the result of transform.
+        if (allocations > 2 * (1 << 10))
+            std::abort();
+        allocations = 0;
+    });
+}
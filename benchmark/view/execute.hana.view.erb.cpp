@@ -0,0 +1,59 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/remove_at.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/take_front.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "../../test/_include/support/tracked.hpp"
+#include "measure.hpp"
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+// A buffer that counts how many times it is copied.
+struct Buffer : Tracked {
+    static int copies;
+    explicit Buffer(int i) : Tracked{i} { }
+    Buffer(Buffer const& other) : Tracked{other} { ++copies; }
+    Buffer(Buffer&&) = default;
+};
+int Buffer::copies = 0;
+
+int main () {
+    hana::benchmark::measure([] {
+        long long result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto buffers = hana::make_tuple(
+                <%= (1..input_size).map { |i| "Buffer{#{i}}" }.join(', ') %>
+            );
+            Buffer::copies = 0;
+
+            auto view = hana::experimental::sliced(buffers,
+                hana::make_range(hana::size_c<0>, hana::size_c<<%= input_size %>>));
+            auto reordered = hana::remove_at(
+                hana::take_front(
+                    hana::drop_front(hana::reverse(view), hana::size_c<1>),
+                    hana::size_c<<%= input_size / 2 %>>
+                ),
+                hana::size_c<0>
+            );
+
+            result += hana::fold_left(reordered, 0, [](int acc, Buffer const& b) {
+                return acc + b.value;
+            });
+
+            // views only remap indices, so no buffer is ever copied
+            if (Buffer::copies != 0)
+                std::abort();
+        }
+        (void)result;
+    });
+}
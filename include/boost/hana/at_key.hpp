@@ -14,11 +14,13 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/accessors.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/struct_key_index.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/find.hpp>
 #include <boost/hana/find_if.hpp>
@@ -108,13 +110,32 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <typename S>
     struct at_key_impl<S, when<hana::Struct<S>::value>> {
+        // When the keys are Hashable, the accessor is found through the key
+        // index of the Struct, which is built once per Struct.
         template <typename X, typename Key>
-        static constexpr decltype(auto) apply(X&& x, Key const& key) {
+        static constexpr decltype(auto) apply_impl(X&& x, Key const&, hana::true_) {
+            using MaybeIndex = typename struct_detail::key_index<S>::template find<Key>;
+            static_assert(!decltype(hana::is_nothing(MaybeIndex{}))::value,
+                "hana::at_key(object, key) requires the 'key' to be a member of the Struct");
+            constexpr std::size_t index = decltype(*MaybeIndex{}){}();
+            return hana::second(hana::at_c<index>(hana::accessors<S>()))(
+                static_cast<X&&>(x)
+            );
+        }
+
+        template <typename X, typename Key>
+        static constexpr decltype(auto) apply_impl(X&& x, Key const& key, hana::false_) {
             auto accessor = hana::second(*hana::find_if(hana::accessors<S>(),
                 hana::equal.to(key) ^hana::on^ hana::first
             ));
             return accessor(static_cast<X&&>(x));
         }
+
+        template <typename X, typename Key>
+        static constexpr decltype(auto) apply(X&& x, Key const& key) {
+            using Indexable = typename struct_detail::key_index<S>::template indexable<Key>;
+            return apply_impl(static_cast<X&&>(x), key, hana::bool_c<Indexable::value>);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
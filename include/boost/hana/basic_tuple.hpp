@@ -79,33 +79,79 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     }
 
-    //////////////////////////////////////////////////////////////////////////
-    // get_impl
-    //////////////////////////////////////////////////////////////////////////
-    template <std::size_t n, typename Xn>
-    constexpr Xn const& get_impl(detail::elt<n, Xn, true> const& xn)
-    { return xn; }
+    namespace detail {
+        //////////////////////////////////////////////////////////////////////
+        // elt_get
+        //
+        // Accessors for the element stored in an `elt`. These are only ever
+        // called with the exact `elt` type, so overload resolution is cheap.
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t n, typename Xn>
+        constexpr Xn const& elt_get(detail::elt<n, Xn, true> const& xn)
+        { return xn; }
+
+        template <std::size_t n, typename Xn>
+        constexpr Xn& elt_get(detail::elt<n, Xn, true>& xn)
+        { return xn; }
+
+        template <std::size_t n, typename Xn>
+        constexpr Xn&& elt_get(detail::elt<n, Xn, true>&& xn)
+        { return static_cast<Xn&&>(xn); }
 
-    template <std::size_t n, typename Xn>
-    constexpr Xn& get_impl(detail::elt<n, Xn, true>& xn)
-    { return xn; }
 
-    template <std::size_t n, typename Xn>
-    constexpr Xn&& get_impl(detail::elt<n, Xn, true>&& xn)
-    { return static_cast<Xn&&>(xn); }
+        template <std::size_t n, typename Xn>
+        constexpr Xn const& elt_get(detail::elt<n, Xn, false> const& xn)
+        { return xn.data_; }
+
+        template <std::size_t n, typename Xn>
+        constexpr Xn& elt_get(detail::elt<n, Xn, false>& xn)
+        { return xn.data_; }
 
+        template <std::size_t n, typename Xn>
+        constexpr Xn&& elt_get(detail::elt<n, Xn, false>&& xn)
+        { return static_cast<Xn&&>(xn.data_); }
+    }
 
-    template <std::size_t n, typename Xn>
-    constexpr Xn const& get_impl(detail::elt<n, Xn, false> const& xn)
-    { return xn.data_; }
+    //////////////////////////////////////////////////////////////////////////
+    // get_impl
+    //
+    // When the compiler can index a parameter pack directly, we use it to
+    // get the exact type of the `elt` base holding the n-th element, and we
+    // cast to that base. Otherwise, the `elt` base is found by deducing it
+    // from the tuple. That requires the compiler to consider every base of
+    // the tuple, so we try to keep the number of overloads to a minimum.
+    //////////////////////////////////////////////////////////////////////////
+#if defined(BOOST_HANA_TYPE_PACK_ELEMENT)
+    template <std::size_t n, typename ...Xn>
+    constexpr decltype(auto) get_impl(hana::basic_tuple<Xn...> const& xs) {
+        using Elt = detail::elt<n, BOOST_HANA_TYPE_PACK_ELEMENT(n, Xn...)>;
+        return detail::elt_get(static_cast<Elt const&>(xs));
+    }
 
-    template <std::size_t n, typename Xn>
-    constexpr Xn& get_impl(detail::elt<n, Xn, false>& xn)
-    { return xn.data_; }
+    template <std::size_t n, typename ...Xn>
+    constexpr decltype(auto) get_impl(hana::basic_tuple<Xn...>& xs) {
+        using Elt = detail::elt<n, BOOST_HANA_TYPE_PACK_ELEMENT(n, Xn...)>;
+        return detail::elt_get(static_cast<Elt&>(xs));
+    }
 
-    template <std::size_t n, typename Xn>
-    constexpr Xn&& get_impl(detail::elt<n, Xn, false>&& xn)
-    { return static_cast<Xn&&>(xn.data_); }
+    template <std::size_t n, typename ...Xn>
+    constexpr decltype(auto) get_impl(hana::basic_tuple<Xn...>&& xs) {
+        using Elt = detail::elt<n, BOOST_HANA_TYPE_PACK_ELEMENT(n, Xn...)>;
+        return detail::elt_get(static_cast<Elt&&>(xs));
+    }
+#else
+    template <std::size_t n, typename Xn, bool b>
+    constexpr Xn const& get_impl(detail::elt<n, Xn, b> const& xn)
+    { return detail::elt_get(xn); }
+
+    template <std::size_t n, typename Xn, bool b>
+    constexpr Xn& get_impl(detail::elt<n, Xn, b>& xn)
+    { return detail::elt_get(xn); }
+
+    template <std::size_t n, typename Xn, bool b>
+    constexpr Xn&& get_impl(detail::elt<n, Xn, b>&& xn)
+    { return detail::elt_get(static_cast<detail::elt<n, Xn, b>&&>(xn)); }
+#endif
 
     namespace detail {
         //////////////////////////////////////////////////////////////////////
@@ -177,7 +223,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr decltype(auto)
         apply(detail::basic_tuple_impl<std::index_sequence<i...>, Xn...> const& xs, F&& f) {
             return static_cast<F&&>(f)(
-                get_impl<i>(static_cast<detail::elt<i, Xn> const&>(xs))...
+                detail::elt_get(static_cast<detail::elt<i, Xn> const&>(xs))...
             );
         }
 
@@ -185,7 +231,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr decltype(auto)
         apply(detail::basic_tuple_impl<std::index_sequence<i...>, Xn...>& xs, F&& f) {
             return static_cast<F&&>(f)(
-                get_impl<i>(static_cast<detail::elt<i, Xn>&>(xs))...
+                detail::elt_get(static_cast<detail::elt<i, Xn>&>(xs))...
             );
         }
 
@@ -193,7 +239,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr decltype(auto)
         apply(detail::basic_tuple_impl<std::index_sequence<i...>, Xn...>&& xs, F&& f) {
             return static_cast<F&&>(f)(
-                get_impl<i>(static_cast<detail::elt<i, Xn>&&>(xs))...
+                detail::elt_get(static_cast<detail::elt<i, Xn>&&>(xs))...
             );
         }
     };
@@ -207,7 +253,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto
         apply(detail::basic_tuple_impl<std::index_sequence<i...>, Xn...> const& xs, F const& f) {
             return hana::make_basic_tuple(
-                f(get_impl<i>(static_cast<detail::elt<i, Xn> const&>(xs)))...
+                f(detail::elt_get(static_cast<detail::elt<i, Xn> const&>(xs)))...
             );
         }
 
@@ -215,7 +261,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto
         apply(detail::basic_tuple_impl<std::index_sequence<i...>, Xn...>& xs, F const& f) {
             return hana::make_basic_tuple(
-                f(get_impl<i>(static_cast<detail::elt<i, Xn>&>(xs)))...
+                f(detail::elt_get(static_cast<detail::elt<i, Xn>&>(xs)))...
             );
         }
 
@@ -223,7 +269,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto
         apply(detail::basic_tuple_impl<std::index_sequence<i...>, Xn...>&& xs, F const& f) {
             return hana::make_basic_tuple(
-                f(get_impl<i>(static_cast<detail::elt<i, Xn>&&>(xs)))...
+                f(detail::elt_get(static_cast<detail::elt<i, Xn>&&>(xs)))...
             );
         }
     };
@@ -0,0 +1,88 @@
+/*!
+@file
+Defines `boost::hana::detail::filter_indices`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_FILTER_INDICES_HPP
+#define BOOST_HANA_DETAIL_FILTER_INDICES_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    // filter_indices:
+    //  Given a sequence of booleans, computes a `constexpr` array holding the
+    //  indices of the `true` booleans, in increasing order. This is the engine
+    //  behind `filter`, `remove_if`, `remove`, `partition`, `unique` and
+    //  `group`: the indices are computed once with a plain loop, and the
+    //  resulting sequence is then built with a single pack expansion (see
+    //  `make_from_indices` below), which keeps the whole thing stable and
+    //  linear in the number of instantiations.
+    //
+    //  `complement` is the `filter_indices` for the negated booleans; it is
+    //  only instantiated when it is actually used.
+    template <bool ...b>
+    struct filter_indices {
+        static constexpr auto compute_indices() {
+            constexpr bool bs[] = {b..., false}; // avoid empty array
+            constexpr std::size_t N = detail::count(bs, bs + sizeof...(b), true);
+            detail::array<std::size_t, N> indices{};
+            std::size_t* keep = &indices[0];
+            for (std::size_t i = 0; i < sizeof...(b); ++i)
+                if (bs[i])
+                    *keep++ = i;
+            return indices;
+        }
+
+        static constexpr auto indices = compute_indices();
+
+        using complement = filter_indices<!b...>;
+    };
+
+    // make_filter_indices:
+    //  Function object meant to be `unpack`ed with a sequence. It returns the
+    //  `filter_indices` of the elements `x` such that `pred(x) == Keep`,
+    //  where the result of `pred(x)` must be a compile-time `Logical`.
+    template <typename Pred, bool Keep = true>
+    struct make_filter_indices {
+        Pred const& pred;
+        template <typename ...X>
+        auto operator()(X&& ...x) const -> filter_indices<
+            static_cast<bool>(detail::decay<
+                decltype(pred(static_cast<X&&>(x)))
+            >::type::value) == Keep...
+        > { return {}; }
+    };
+
+    // make_from_indices:
+    //  Creates a sequence with tag `S` holding the elements of `xs` at the
+    //  indices given by `Indices::indices`, in that order.
+    template <typename S, typename Indices, typename Xs, std::size_t ...i>
+    constexpr auto make_from_indices_impl(Xs&& xs, std::index_sequence<i...>) {
+        return hana::make<S>(
+            hana::at_c<Indices::indices[i]>(static_cast<Xs&&>(xs))...
+        );
+    }
+
+    template <typename S, typename Indices, typename Xs>
+    constexpr auto make_from_indices(Xs&& xs) {
+        return detail::make_from_indices_impl<S, Indices>(
+            static_cast<Xs&&>(xs),
+            std::make_index_sequence<Indices::indices.size()>{}
+        );
+    }
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_FILTER_INDICES_HPP
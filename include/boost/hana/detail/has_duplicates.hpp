@@ -11,26 +11,72 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_DETAIL_HAS_DUPLICATES_HPP
 
 #include <boost/hana/config.hpp>
-#include <boost/hana/detail/fast_and.hpp>
-#include <boost/hana/equal.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail {
-    template <typename T, typename ...U>
-    constexpr std::size_t pack_count() {
-        std::size_t c = 0;
-        std::size_t expand[] = {0, // avoid empty array
-            (decltype(hana::equal(std::declval<T>(), std::declval<U>()))::value
-                ? ++c
-                : c)...
-        };
-        (void)expand;
-
-        return c;
-    }
+    template <typename Bucket>
+    struct bucket_size;
+
+    template <typename Hash, std::size_t ...i>
+    struct bucket_size<bucket<Hash, i...>>
+        : std::integral_constant<std::size_t, sizeof...(i)>
+    { };
+
+    template <typename HashTable>
+    struct hash_table_size;
+
+    template <typename ...Buckets>
+    struct hash_table_size<hash_table<Buckets...>> {
+        static constexpr std::size_t compute() {
+            std::size_t sizes[] = {0, bucket_size<Buckets>::value...};
+            std::size_t total = 0;
+            for (std::size_t size : sizes)
+                total += size;
+            return total;
+        }
+
+        static constexpr std::size_t value = compute();
+    };
+
+    template <template <std::size_t> class KeyAtIndex, typename FlatTable,
+              typename Indices, bool HasCollisions>
+    struct has_duplicates_impl {
+        static constexpr bool value = false;
+    };
+
+    template <template <std::size_t> class KeyAtIndex, typename FlatTable, std::size_t ...i>
+    struct has_duplicates_impl<KeyAtIndex, FlatTable, std::index_sequence<i...>, true> {
+        // Inserting the keys one by one only compares keys that fall in the
+        // same bucket, and `bucket_insert` does not insert a key that is
+        // already present in its bucket. Hence, there are duplicates iff
+        // some keys did not make it in the resulting table.
+        using HashTable = typename make_collision_safe_hash_table_impl<
+            KeyAtIndex, FlatTable, std::index_sequence<i...>, true
+        >::type;
+        static constexpr bool value = hash_table_size<HashTable>::value != sizeof...(i);
+    };
+
+    // has_duplicate_keys:
+    //  Returns whether any two of the first `N` keys retrievable with the
+    //  `KeyAtIndex` alias are equal. If no two hashes collide, no keys are
+    //  ever compared.
+    template <template <std::size_t> class KeyAtIndex, std::size_t N,
+              typename Indices = std::make_index_sequence<N>>
+    struct has_duplicate_keys;
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N, std::size_t ...i>
+    struct has_duplicate_keys<KeyAtIndex, N, std::index_sequence<i...>> {
+        using FlatTable = typename make_hash_table<KeyAtIndex, N>::type;
+        static constexpr bool value = has_duplicates_impl<
+            KeyAtIndex, FlatTable, std::index_sequence<i...>,
+            has_hash_collisions<FlatTable, KeyAtIndex, i...>::value
+        >::value;
+    };
 
     //! @ingroup group-details
     //! Returns whether any of the `T`s are duplicate w.r.t. `hana::equal`.
@@ -41,24 +87,17 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     //! the comparison to return an `IntegralConstant` that can be explicitly
     //! converted to `bool`.
     //!
-    //! @note
-    //! Since this utility is mostly used in assertions to check that there
-    //! are no duplicates in a sequence, we expect it to return `false` most
-    //! of the time (otherwise we will assert). Hence, this implementation is
-    //! biased towards the fact that we __will__ have to compare every pair of
-    //! elements in most cases, and it does not try to be lazy.
-    //!
-    //! @todo
-    //! This implementation is O(n^2). We could do it in O(n), but that would
-    //! require a more elaborate setup including storage with O(1) lookup
-    //! (which could be based on a compile-time hash). If we implement such
-    //! storage for associative sequences, we could use it to optimize this.
+    //! The `T`s must also be `Hashable`, since the check is performed with
+    //! a `detail::hash_table`. Two `T`s can only be equal if their hashes
+    //! are equal, so only the `T`s whose hashes collide are ever compared.
+    //! When no hashes collide, which is the case whenever there are no
+    //! duplicates and no two distinct `T`s hash to the same value, this
+    //! is O(n) in the number of `T`s.
     template <typename ...T>
     struct has_duplicates {
-        static constexpr bool value =
-            sizeof...(T) > 0 &&
-            !detail::fast_and<(detail::pack_count<T, T...>() == 1)...>::value
-        ;
+        static constexpr bool value = has_duplicate_keys<
+            PackKeyAtIndex<T...>::template apply, sizeof...(T)
+        >::value;
     };
 } BOOST_HANA_NAMESPACE_END
 
@@ -11,6 +11,9 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_HASH_TABLE_HPP
 #define BOOST_HANA_DETAIL_HASH_TABLE_HPP
 
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/type_foldl1.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/ext/std/integer_sequence.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
@@ -38,12 +41,16 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
 
     // find_indices:
     //  Returns an `index_sequence` containing possible indices for the given
-    //  `Key` in the `Map`.
+    //  `Key` in the `Map`. If the `Map` contains no bucket for the hash of
+    //  `Key`, `no_bucket` is returned instead. Note that a bucket may exist
+    //  but be empty, when all of its indices were removed by `bucket_erase`.
+    struct no_bucket { };
+
     template <typename Hash, std::size_t ...i>
     std::index_sequence<i...> find_indices_impl(bucket<Hash, i...> const&);
 
     template <typename Hash>
-    std::index_sequence<> find_indices_impl(...);
+    no_bucket find_indices_impl(...);
 
     template <typename Map, typename Key>
     struct find_indices {
@@ -70,6 +77,16 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using type = decltype(hana::find_if(Indices{}, find_pred<KeyAtIndex, Key>{}));
     };
 
+    template <typename Key, template <std::size_t> class KeyAtIndex>
+    struct find_index_impl<no_bucket, Key, KeyAtIndex> {
+        using type = hana::optional<>;
+    };
+
+    template <typename Key, template <std::size_t> class KeyAtIndex>
+    struct find_index_impl<std::index_sequence<>, Key, KeyAtIndex> {
+        using type = hana::optional<>;
+    };
+
     // This is a peephole optimization for buckets that have a single entry.
     // It provides a nice speedup in the at_key.number_of_lookups benchmark.
     // It is perhaps possible to make this part of `find_if` itself, but we
@@ -91,10 +108,22 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using Indices = typename find_indices<Map, Key>::type;
         using type = typename find_index_impl<Indices, Key, KeyAtIndex>::type;
     };
+
+    // Looking up a key in an empty table never requires hashing the key.
+    template <typename Key, template <std::size_t> class KeyAtIndex>
+    struct find_index<hash_table<>, Key, KeyAtIndex> {
+        using type = hana::optional<>;
+    };
     // end find_index
 
     // bucket_insert:
-    //  Inserts the given `Index` into the bucket of the `Map` in which `Key` falls.
+    //  Inserts the given `Index` into the bucket of the `Map` in which `Key`
+    //  falls, unless a key equal to `Key` is already present in that bucket.
+    //  `type` is the resulting `hash_table`, and `found` is the result of
+    //  `find_index` for `Key` in the original `Map`, i.e. an `optional`
+    //  containing the index of the existing key, or `optional<>` if the
+    //  `Index` was inserted. Keys are only compared when their bucket is
+    //  not empty, which makes the insertion of a new hash very cheap.
     template <typename Bucket, typename Hash, std::size_t Index>
     struct update_bucket {
         using type = Bucket;
@@ -105,26 +134,97 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using type = bucket<Hash, i..., Index>;
     };
 
-    template <typename Map, typename Key, std::size_t Index, bool =
-        (find_indices<Map, Key>::type::size() > 0)
-    >
-    struct bucket_insert;
+    template <typename Map, typename Hash, std::size_t Index, typename Found>
+    struct bucket_append {
+        // The key is already in the Map; leave it unchanged.
+        using type = Map;
+    };
 
-    template <typename ...Buckets, typename Key, std::size_t Index>
-    struct bucket_insert<hash_table<Buckets...>, Key, Index, true> {
+    template <typename ...Buckets, typename Hash, std::size_t Index>
+    struct bucket_append<hash_table<Buckets...>, Hash, Index, hana::optional<>> {
         // There is a bucket for that Hash; append the new index to it.
-        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = hash_table<typename update_bucket<Buckets, Hash, Index>::type...>;
     };
 
-    template <typename ...Buckets, typename Key, std::size_t Index>
-    struct bucket_insert<hash_table<Buckets...>, Key, Index, false> {
+    template <typename Map, typename Key, std::size_t Index,
+              template <std::size_t> class KeyAtIndex,
+              typename Indices = typename find_indices<Map, Key>::type>
+    struct bucket_insert {
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using found = typename find_index_impl<Indices, Key, KeyAtIndex>::type;
+        using type = typename bucket_append<Map, Hash, Index, found>::type;
+    };
+
+    template <typename ...Buckets, typename Key, std::size_t Index,
+              template <std::size_t> class KeyAtIndex>
+    struct bucket_insert<hash_table<Buckets...>, Key, Index, KeyAtIndex, no_bucket> {
         // There is no bucket for that Hash; insert a new bucket.
         using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using found = hana::optional<>;
         using type = hash_table<Buckets..., bucket<Hash, Index>>;
     };
     // end bucket_insert
 
+    // bucket_erase:
+    //  Removes the given `Index`, which must be the index of `Key`, from the
+    //  bucket of the `Map` in which `Key` falls. Since the element at `Index`
+    //  is removed from the underlying storage, all the indices greater than
+    //  `Index` are decremented so they keep referring to the same elements.
+    //  The bucket of `Key` is kept even when it becomes empty, so that it
+    //  can be reused if a key with the same hash is inserted again.
+    template <std::size_t Index, std::size_t ...i>
+    struct erase_index {
+        static constexpr auto compute_indices() {
+            constexpr std::size_t is[] = {i...};
+            detail::array<std::size_t, sizeof...(i) - 1> indices{};
+            std::size_t* out = &indices[0];
+            for (std::size_t n = 0; n < sizeof...(i); ++n)
+                if (is[n] != Index)
+                    *out++ = is[n] > Index ? is[n] - 1 : is[n];
+            return indices;
+        }
+
+        static constexpr auto indices = compute_indices();
+    };
+
+    template <typename Hash, typename Indices, typename Erased>
+    struct make_erased_bucket;
+
+    template <typename Hash, std::size_t ...n, typename Erased>
+    struct make_erased_bucket<Hash, std::index_sequence<n...>, Erased> {
+        using type = bucket<Hash, Erased::indices[n]...>;
+    };
+
+    template <typename Bucket, typename Hash, std::size_t Index>
+    struct erase_from_bucket;
+
+    template <typename OtherHash, std::size_t ...i, typename Hash, std::size_t Index>
+    struct erase_from_bucket<bucket<OtherHash, i...>, Hash, Index> {
+        using type = bucket<OtherHash, (i > Index ? i - 1 : i)...>;
+    };
+
+    template <std::size_t ...i, typename Hash, std::size_t Index>
+    struct erase_from_bucket<bucket<Hash, i...>, Hash, Index> {
+        using type = typename make_erased_bucket<
+            Hash, std::make_index_sequence<sizeof...(i) - 1>, erase_index<Index, i...>
+        >::type;
+    };
+
+    template <typename Hash, std::size_t Index>
+    struct erase_from_bucket<bucket<Hash, Index>, Hash, Index> {
+        using type = bucket<Hash>;
+    };
+
+    template <typename Map, typename Key, std::size_t Index>
+    struct bucket_erase;
+
+    template <typename ...Buckets, typename Key, std::size_t Index>
+    struct bucket_erase<hash_table<Buckets...>, Key, Index> {
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using type = hash_table<typename erase_from_bucket<Buckets, Hash, Index>::type...>;
+    };
+    // end bucket_erase
+
     // make_hash_table:
     //  Creates a `hash_table` type able of holding the given number of
     //  elements. The type of the key associated to any given index must
@@ -140,6 +240,94 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
             bucket<typename decltype(hana::hash(std::declval<KeyAtIndex<i>>()))::type, i>...
         >;
     };
+
+    // PackKeyAtIndex:
+    //  Provides a `KeyAtIndex` alias for keys given directly as a pack of
+    //  types, for example to build a `hash_table` over the keys of elements
+    //  that are not stored anywhere yet.
+    template <std::size_t i, typename Key>
+    struct indexed_key {
+        using type = Key;
+    };
+
+    template <typename Indices, typename ...Keys>
+    struct key_indexer;
+
+    template <std::size_t ...i, typename ...Keys>
+    struct key_indexer<std::index_sequence<i...>, Keys...>
+        : indexed_key<i, Keys>...
+    { };
+
+    template <std::size_t i, typename Key>
+    indexed_key<i, Key> get_indexed_key(indexed_key<i, Key> const&);
+
+    template <typename ...Keys>
+    struct PackKeyAtIndex {
+        using Indexer = key_indexer<std::make_index_sequence<sizeof...(Keys)>, Keys...>;
+
+        template <std::size_t i>
+        using apply = typename decltype(
+            detail::get_indexed_key<i>(std::declval<Indexer>())
+        )::type;
+    };
+    // end PackKeyAtIndex
+
+    // make_collision_safe_hash_table:
+    //  Creates a `hash_table` type holding the given number of elements,
+    //  like `make_hash_table`. However, the keys are only required to be
+    //  distinct; keys whose hashes collide end up in the same bucket. When
+    //  no hashes collide (the usual case), the flat table created by
+    //  `make_hash_table` is used directly. Otherwise, the table is built
+    //  by inserting the indices one by one with `bucket_insert`.
+    //
+    //  Collisions are detected without comparing hashes pairwise: when two
+    //  buckets share the same `Hash`, looking up that `Hash` in the flat
+    //  table is ambiguous and `find_indices` yields `no_bucket`.
+    template <template <std::size_t> class KeyAtIndex>
+    struct bucket_insert_at {
+        template <typename HashTable, typename Index>
+        using apply = bucket_insert<HashTable, KeyAtIndex<Index::value>,
+                                    Index::value, KeyAtIndex>;
+    };
+
+    template <typename FlatTable, template <std::size_t> class KeyAtIndex,
+              std::size_t ...i>
+    struct has_hash_collisions {
+        static constexpr bool value = !detail::fast_and<
+            std::is_same<typename find_indices<FlatTable, KeyAtIndex<i>>::type,
+                         std::index_sequence<i>>::value...
+        >::value;
+    };
+
+    template <template <std::size_t> class KeyAtIndex, typename FlatTable,
+              typename Indices, bool HasCollisions>
+    struct make_collision_safe_hash_table_impl {
+        using type = FlatTable;
+    };
+
+    template <template <std::size_t> class KeyAtIndex, typename FlatTable, std::size_t ...i>
+    struct make_collision_safe_hash_table_impl<
+        KeyAtIndex, FlatTable, std::index_sequence<i...>, true
+    > {
+        using type = typename detail::type_foldl1<
+            bucket_insert_at<KeyAtIndex>::template apply,
+            hash_table<>,
+            std::integral_constant<std::size_t, i>...
+        >::type;
+    };
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N,
+              typename Indices = std::make_index_sequence<N>>
+    struct make_collision_safe_hash_table;
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N, std::size_t ...i>
+    struct make_collision_safe_hash_table<KeyAtIndex, N, std::index_sequence<i...>> {
+        using FlatTable = typename make_hash_table<KeyAtIndex, N>::type;
+        using type = typename make_collision_safe_hash_table_impl<
+            KeyAtIndex, FlatTable, std::index_sequence<i...>,
+            has_hash_collisions<FlatTable, KeyAtIndex, i...>::value
+        >::type;
+    };
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_HASH_TABLE_HPP
@@ -39,6 +39,23 @@ Distributed under the Boost Software License, Version 1.0.
 #   endif
 #endif
 
+// The following intrinsics have no library fallback in C++14 (or none that
+// is as cheap), so these macros are only defined when the intrinsic is
+// available; code using them must provide its own alternative.
+#if defined(__has_builtin)
+#   if __has_builtin(__type_pack_element)
+#       define BOOST_HANA_TYPE_PACK_ELEMENT(n, ...) __type_pack_element<n, __VA_ARGS__>
+#   endif
+
+#   if __has_builtin(__has_unique_object_representations)
+#       define BOOST_HANA_TT_HAS_UNIQUE_OBJECT_REPRESENTATIONS(T) __has_unique_object_representations(T)
+#   endif
+
+#   if __has_builtin(__builtin_is_constant_evaluated)
+#       define BOOST_HANA_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#   endif
+#endif
+
 #if !defined(BOOST_HANA_TT_IS_EMPTY)
 #   include <type_traits>
 #   define BOOST_HANA_TT_IS_EMPTY(T) ::std::is_empty<T>::value
@@ -0,0 +1,125 @@
+/*!
+@file
+Defines `boost::hana::detail::sort_helper`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_MERGE_SORT_HPP
+#define BOOST_HANA_DETAIL_MERGE_SORT_HPP
+
+#include <boost/hana/config.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    // sort_helper:
+    //  Stable merge sort of the indices `0, ..., n-1`, where `Pred::apply<i, j>`
+    //  must be a compile-time boolean telling whether the element at index
+    //  `i` is less than the element at index `j`. The sorted indices are
+    //  given as a `std::index_sequence` in `sort_helper<...>::type`.
+    //
+    // merge:
+    //  Merges two sorted sequences of indices. An index from the `Right`
+    //  sequence is only taken when it is strictly less than the head of
+    //  the `Left` sequence, which keeps the sort stable.
+    template <typename Pred, typename Merged, typename Left, typename Right>
+    struct merge;
+
+    template <typename Pred, typename Merged, typename Left, typename Right,
+              bool TakeRight>
+    struct merge_step;
+
+    template <typename Pred, std::size_t ...m,
+              std::size_t l, std::size_t ...ls,
+              std::size_t r, std::size_t ...rs>
+    struct merge_step<Pred, std::index_sequence<m...>,
+                      std::index_sequence<l, ls...>,
+                      std::index_sequence<r, rs...>, false>
+    {
+        using type = typename merge<
+            Pred, std::index_sequence<m..., l>,
+            std::index_sequence<ls...>, std::index_sequence<r, rs...>
+        >::type;
+    };
+
+    template <typename Pred, std::size_t ...m,
+              std::size_t l, std::size_t ...ls,
+              std::size_t r, std::size_t ...rs>
+    struct merge_step<Pred, std::index_sequence<m...>,
+                      std::index_sequence<l, ls...>,
+                      std::index_sequence<r, rs...>, true>
+    {
+        using type = typename merge<
+            Pred, std::index_sequence<m..., r>,
+            std::index_sequence<l, ls...>, std::index_sequence<rs...>
+        >::type;
+    };
+
+    template <typename Pred, std::size_t ...m,
+              std::size_t l, std::size_t ...ls,
+              std::size_t r, std::size_t ...rs>
+    struct merge<Pred, std::index_sequence<m...>,
+                 std::index_sequence<l, ls...>,
+                 std::index_sequence<r, rs...>>
+        : merge_step<Pred, std::index_sequence<m...>,
+                     std::index_sequence<l, ls...>,
+                     std::index_sequence<r, rs...>,
+                     (bool)Pred::template apply<r, l>::value>
+    { };
+
+    template <typename Pred, std::size_t ...m, std::size_t ...ls>
+    struct merge<Pred, std::index_sequence<m...>,
+                 std::index_sequence<ls...>,
+                 std::index_sequence<>>
+    {
+        using type = std::index_sequence<m..., ls...>;
+    };
+
+    template <typename Pred, std::size_t ...m, std::size_t r, std::size_t ...rs>
+    struct merge<Pred, std::index_sequence<m...>,
+                 std::index_sequence<>,
+                 std::index_sequence<r, rs...>>
+    {
+        using type = std::index_sequence<m..., r, rs...>;
+    };
+
+    // merge_sort:
+    //  Sorts the indices in the range [First, Last). This instantiates
+    //  O(n log n) comparisons, with a recursion depth that is logarithmic
+    //  in the number of elements (plus that of the final merge).
+    template <typename Pred, std::size_t First, std::size_t Last,
+              std::size_t Size = Last - First>
+    struct merge_sort {
+        static constexpr std::size_t Middle = First + Size / 2;
+        using type = typename merge<
+            Pred, std::index_sequence<>,
+            typename merge_sort<Pred, First, Middle>::type,
+            typename merge_sort<Pred, Middle, Last>::type
+        >::type;
+    };
+
+    template <typename Pred, std::size_t First, std::size_t Last>
+    struct merge_sort<Pred, First, Last, 0> {
+        using type = std::index_sequence<>;
+    };
+
+    template <typename Pred, std::size_t First, std::size_t Last>
+    struct merge_sort<Pred, First, Last, 1> {
+        using type = std::index_sequence<First>;
+    };
+
+    template <typename Pred, typename Indices>
+    struct sort_helper;
+
+    template <typename Pred, std::size_t ...i>
+    struct sort_helper<Pred, std::index_sequence<i...>> {
+        using type = typename merge_sort<Pred, 0, sizeof...(i)>::type;
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_MERGE_SORT_HPP
@@ -103,4 +103,125 @@ Distributed under the Boost Software License, Version 1.0.
 //! This macro may not be called with less than 2 arguments.
 #define BOOST_HANA_PP_DROP_FRONT(e0, ...) __VA_ARGS__
 
+//! @ingroup group-details
+//! Expands to `f(data, x1) f(data, x2) ... f(data, xn)`.
+//!
+//! Specifically, `BOOST_HANA_PP_FOR_EACH(f, data, x1, ..., xn)` applies the
+//! macro `f` to each of `x1, ..., xn`, passing `data` along unchanged, and
+//! `BOOST_HANA_PP_FOR_EACH(f, data)` expands to nothing. Unlike the macros
+//! above, this does not dispatch on `BOOST_HANA_PP_NARG`, and the cost of
+//! the expansion is proportional to the number of arguments. This macro can
+//! be passed up to 1024 arguments after `data`.
+#define BOOST_HANA_PP_FOR_EACH(f, ...) \
+    BOOST_HANA_PP_EACH_0(f, __VA_ARGS__, BOOST_HANA_PP_EACH_END)
+
+//! @ingroup group-details
+//! Expands to `f(data, x1), f(data, x2), ..., f(data, xn)`.
+//!
+//! This is the same as `BOOST_HANA_PP_FOR_EACH`, except the results are
+//! separated by commas.
+#define BOOST_HANA_PP_ENUM(f, ...) \
+    BOOST_HANA_PP_ENUM_EXPAND(f, __VA_ARGS__, BOOST_HANA_PP_EACH_END)
+
+#define BOOST_HANA_PP_ENUM_EXPAND(...) BOOST_HANA_PP_ENUM_IMPL(__VA_ARGS__)
+
+#define BOOST_HANA_PP_ENUM_IMPL(f, d, x, ...)                               \
+    BOOST_HANA_PP_EACH_GUARD(f, d, x)                                       \
+    BOOST_HANA_PP_EACH_0(BOOST_HANA_PP_ENUM_NEXT, (f, d), __VA_ARGS__)      \
+/**/
+#define BOOST_HANA_PP_ENUM_NEXT(fd, x) \
+    , BOOST_HANA_PP_ENUM_CALL(BOOST_HANA_PP_ENUM_STRIP fd, x)
+#define BOOST_HANA_PP_ENUM_STRIP(...) __VA_ARGS__
+#define BOOST_HANA_PP_ENUM_CALL(...) BOOST_HANA_PP_ENUM_CALL_IMPL(__VA_ARGS__)
+#define BOOST_HANA_PP_ENUM_CALL_IMPL(f, d, x) f(d, x)
+
+// The arguments are processed by chunks of 16. `BOOST_HANA_PP_EACH_n` handles
+// the n-th chunk and then calls `BOOST_HANA_PP_EACH_n+1` with the remaining
+// arguments, unless there are none. The end of the arguments is marked by
+// `BOOST_HANA_PP_EACH_END`, whose `()()()` elements are the only arguments
+// for which `BOOST_HANA_PP_EACH_IS_END_0` expands to `0, BOOST_HANA_PP_EACH_NONE`;
+// this is what `BOOST_HANA_PP_EACH_GUARD` and `BOOST_HANA_PP_EACH_SELECT`
+// use to skip them. The chunks are distinct macros because a macro can't be
+// expanded from within its own expansion, and the chain is only as long as
+// needed, so small argument lists are cheap. More arguments can be supported
+// by adding chunks.
+#define BOOST_HANA_PP_EACH_END ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), ()()(), 0
+#define BOOST_HANA_PP_EACH_NONE(...)
+#define BOOST_HANA_PP_EACH_IS_END_2() 0, BOOST_HANA_PP_EACH_NONE
+#define BOOST_HANA_PP_EACH_IS_END_1(...) BOOST_HANA_PP_EACH_IS_END_2
+#define BOOST_HANA_PP_EACH_IS_END_0(...) BOOST_HANA_PP_EACH_IS_END_1
+#define BOOST_HANA_PP_EACH_SELECT(test, next) BOOST_HANA_PP_EACH_SELECT_IMPL(test, next, 0)
+#define BOOST_HANA_PP_EACH_SELECT_IMPL(test, next, ...) next
+#define BOOST_HANA_PP_EACH_GUARD(g, d, x) \
+    BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_IS_END_0 x, g)(d, x)
+
+#define BOOST_HANA_PP_EACH_BODY(g, d, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, ...) BOOST_HANA_PP_EACH_GUARD(g, d, x0) BOOST_HANA_PP_EACH_GUARD(g, d, x1) BOOST_HANA_PP_EACH_GUARD(g, d, x2) BOOST_HANA_PP_EACH_GUARD(g, d, x3) BOOST_HANA_PP_EACH_GUARD(g, d, x4) BOOST_HANA_PP_EACH_GUARD(g, d, x5) BOOST_HANA_PP_EACH_GUARD(g, d, x6) BOOST_HANA_PP_EACH_GUARD(g, d, x7) BOOST_HANA_PP_EACH_GUARD(g, d, x8) BOOST_HANA_PP_EACH_GUARD(g, d, x9) BOOST_HANA_PP_EACH_GUARD(g, d, x10) BOOST_HANA_PP_EACH_GUARD(g, d, x11) BOOST_HANA_PP_EACH_GUARD(g, d, x12) BOOST_HANA_PP_EACH_GUARD(g, d, x13) BOOST_HANA_PP_EACH_GUARD(g, d, x14) BOOST_HANA_PP_EACH_GUARD(g, d, x15)
+#define BOOST_HANA_PP_EACH_PEEK(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, peek, ...) BOOST_HANA_PP_EACH_IS_END_0 peek
+#define BOOST_HANA_PP_EACH_REST(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, ...) __VA_ARGS__
+
+#define BOOST_HANA_PP_EACH_0(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_1)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_1(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_2)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_2(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_3)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_3(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_4)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_4(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_5)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_5(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_6)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_6(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_7)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_7(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_8)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_8(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_9)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_9(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_10)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_10(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_11)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_11(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_12)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_12(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_13)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_13(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_14)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_14(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_15)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_15(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_16)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_16(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_17)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_17(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_18)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_18(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_19)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_19(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_20)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_20(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_21)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_21(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_22)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_22(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_23)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_23(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_24)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_24(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_25)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_25(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_26)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_26(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_27)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_27(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_28)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_28(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_29)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_29(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_30)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_30(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_31)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_31(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_32)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_32(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_33)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_33(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_34)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_34(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_35)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_35(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_36)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_36(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_37)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_37(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_38)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_38(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_39)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_39(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_40)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_40(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_41)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_41(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_42)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_42(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_43)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_43(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_44)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_44(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_45)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_45(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_46)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_46(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_47)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_47(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_48)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_48(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_49)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_49(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_50)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_50(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_51)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_51(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_52)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_52(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_53)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_53(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_54)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_54(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_55)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_55(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_56)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_56(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_57)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_57(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_58)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_58(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_59)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_59(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_60)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_60(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_61)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_61(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_62)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_62(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_63)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+#define BOOST_HANA_PP_EACH_63(g, d, ...) BOOST_HANA_PP_EACH_BODY(g, d, __VA_ARGS__) BOOST_HANA_PP_EACH_SELECT(BOOST_HANA_PP_EACH_PEEK(__VA_ARGS__), BOOST_HANA_PP_EACH_too_many_arguments)(g, d, BOOST_HANA_PP_EACH_REST(__VA_ARGS__))
+
 #endif // !BOOST_HANA_DETAIL_PREPROCESSOR_HPP
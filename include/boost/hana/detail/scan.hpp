@@ -0,0 +1,78 @@
+/*!
+@file
+Defines `boost::hana::detail::homogeneous_scan` and
+`boost::hana::detail::scan_step`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_SCAN_HPP
+#define BOOST_HANA_DETAIL_SCAN_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Tells whether scanning the elements of `Xs` at indices `Start + i...`
+    //! with an initial state of type `T` only produces states of type `T`.
+    //!
+    //! This is the case when all these elements have the same type and `f`
+    //! returns a `T` when called with a `T` and such an element, as
+    //! `f(state, x)` for `scan_left` (`Left`) and `f(x, state)` for
+    //! `scan_right`. The type returned by `f` is only looked at when all
+    //! the elements have the same type, so that `f` is never called (even
+    //! in an unevaluated context) with arguments it would not be called
+    //! with by the scan.
+    template <bool Left, typename Xs, typename T, typename F, std::size_t Start,
+              typename Indices, typename = void>
+    struct homogeneous_scan : std::false_type { };
+
+    template <bool Left, typename X, typename T, typename F>
+    struct scan_result;
+
+    template <typename X, typename T, typename F>
+    struct scan_result<true, X, T, F> {
+        using type = decltype(std::declval<F const&>()(std::declval<T&>(), std::declval<X>()));
+    };
+
+    template <typename X, typename T, typename F>
+    struct scan_result<false, X, T, F> {
+        using type = decltype(std::declval<F const&>()(std::declval<X>(), std::declval<T&>()));
+    };
+
+    template <bool Left, typename Xs, typename T, typename F, std::size_t Start,
+              std::size_t i0, std::size_t ...i>
+    struct homogeneous_scan<Left, Xs, T, F, Start, std::index_sequence<i0, i...>,
+        typename std::enable_if<detail::fast_and<std::is_same<
+            decltype(hana::at_c<Start + i0>(std::declval<Xs>())),
+            decltype(hana::at_c<Start + i>(std::declval<Xs>()))
+        >::value...>::value>::type
+    >
+        : std::integral_constant<bool,
+            std::is_copy_assignable<T>::value &&
+            std::is_same<typename detail::decay<typename scan_result<
+                Left, decltype(hana::at_c<Start + i0>(std::declval<Xs>())), T, F
+            >::type>::type, T>::value
+        >
+    { };
+
+    //! @ingroup group-details
+    //! The number of elements handled by the next step of a scan, given
+    //! the number of elements that remain to be handled.
+    template <std::size_t Remaining>
+    using scan_step = std::integral_constant<std::size_t,
+        (Remaining >= 4 ? 4 : Remaining >= 1 ? 1 : 0)
+    >;
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_SCAN_HPP
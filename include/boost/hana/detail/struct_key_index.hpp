@@ -0,0 +1,100 @@
+/*!
+@file
+Defines `boost::hana::struct_detail::key_index`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_STRUCT_KEY_INDEX_HPP
+#define BOOST_HANA_DETAIL_STRUCT_KEY_INDEX_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/concept/hashable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/hash_table.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace struct_detail {
+    // key_index:
+    //  Hash table over the keys of the accessors of the Struct `S`, built
+    //  the first time a key is looked up in `S` and reused afterwards, so
+    //  that looking up a key costs a hash lookup instead of a linear search
+    //  through the accessors. This is the same table `hana::map` uses.
+    //
+    //  `find<Key>` is an `optional` containing the index of the accessor
+    //  for `Key`, or an empty `optional` if there is no such accessor. The
+    //  table can only be used when `Key` and all the keys of `S` can be
+    //  hashed, which `indexable<Key>` tells.
+    //
+    //  Hashing a constant holding a pointer to member requires passing it
+    //  as a template argument, which not all compilers accept in C++14, so
+    //  such keys are always looked up linearly.
+    template <typename Key, typename = void>
+    struct hashable_key
+        : std::integral_constant<bool, hana::Hashable<Key>::value>
+    { };
+
+    template <typename Key>
+    struct hashable_key<Key, typename std::enable_if<
+        std::is_member_pointer<decltype(Key::value)>::value
+    >::type>
+        : std::false_type
+    { };
+
+    struct collect_keys {
+        template <typename ...Accessor>
+        auto operator()(Accessor&& ...) const -> detail::type_pack<
+            typename detail::decay<decltype(hana::first(std::declval<Accessor>()))>::type...
+        >;
+    };
+
+    template <typename Keys>
+    struct all_hashable;
+
+    template <typename ...Key>
+    struct all_hashable<detail::type_pack<Key...>>
+        : detail::fast_and<hashable_key<Key>::value...>
+    { };
+
+    template <typename S>
+    struct key_index {
+        using Accessors = decltype(hana::accessors<S>());
+        using Keys = decltype(hana::unpack(std::declval<Accessors>(), collect_keys{}));
+
+        template <typename Key>
+        using indexable = std::integral_constant<bool,
+            hashable_key<Key>::value && all_hashable<Keys>::value
+        >;
+
+        template <std::size_t i>
+        using KeyAtIndex = typename Keys::template at<i>;
+
+        template <typename Pack>
+        struct make_table;
+
+        template <typename ...Key>
+        struct make_table<detail::type_pack<Key...>>
+            : detail::make_collision_safe_hash_table<KeyAtIndex, sizeof...(Key)>
+        { };
+
+        // `Pack` is only there to make the table dependent, so that it is
+        // not built unless `find` is actually used.
+        template <typename Key, typename Pack = Keys>
+        using find = typename detail::find_index<
+            typename make_table<Pack>::type, Key, KeyAtIndex
+        >::type;
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_STRUCT_KEY_INDEX_HPP
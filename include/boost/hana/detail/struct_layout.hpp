@@ -0,0 +1,89 @@
+/*!
+@file
+Defines `boost::hana::struct_detail::member_ptr` and
+`boost::hana::struct_detail::bitwise_comparable`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_STRUCT_LAYOUT_HPP
+#define BOOST_HANA_DETAIL_STRUCT_LAYOUT_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
+#include <boost/hana/fwd/pair.hpp>
+#include <boost/hana/fwd/tuple.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace struct_detail {
+    // member_ptr:
+    //  Accessor for the data member `ptr`. This is the accessor used by
+    //  `BOOST_HANA_DEFINE_STRUCT` and `BOOST_HANA_ADAPT_STRUCT`; since it
+    //  keeps the member pointer in its type, it also tells us exactly which
+    //  part of the object is accessed.
+    template <typename Memptr, Memptr ptr>
+    struct member_ptr {
+        template <typename T>
+        constexpr decltype(auto) operator()(T&& t) const
+        { return static_cast<T&&>(t).*ptr; }
+    };
+
+    // bitwise_comparable:
+    //  Whether two objects of type `T` are equal if and only if their object
+    //  representations are equal, i.e. whether they can be compared with
+    //  `std::memcmp`. This is the case for integral types and pointers, and
+    //  for `Struct`s whose accessors are all `member_ptr`s to such members,
+    //  provided the members are the whole object (no padding, no unlisted
+    //  members or bases). Since this requires knowing whether the type has
+    //  padding, it is always false when the compiler can't tell us.
+    template <typename T, typename = void>
+    struct bitwise_comparable
+        : std::integral_constant<bool,
+            std::is_integral<T>::value || std::is_pointer<T>::value
+        >
+    { };
+
+    template <typename S, typename Accessors>
+    struct bitwise_comparable_members : std::false_type { };
+
+#if defined(BOOST_HANA_TT_HAS_UNIQUE_OBJECT_REPRESENTATIONS)
+    template <std::size_t N>
+    constexpr std::size_t sum(std::size_t const (&sizes)[N]) {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i != N; ++i)
+            total += sizes[i];
+        return total;
+    }
+
+    template <typename S, typename ...Key, typename ...M, typename ...C, M C::* ...ptr>
+    struct bitwise_comparable_members<S, hana::tuple<
+        hana::pair<Key, member_ptr<M C::*, ptr>>...
+    >>
+        : std::integral_constant<bool,
+            detail::fast_and<bitwise_comparable<M>::value...>::value &&
+            std::is_trivially_copyable<S>::value &&
+            BOOST_HANA_TT_HAS_UNIQUE_OBJECT_REPRESENTATIONS(S) &&
+            struct_detail::sum({std::size_t{0}, sizeof(M)...}) == sizeof(S)
+        >
+    { };
+#endif
+
+    template <typename S>
+    struct bitwise_comparable<S, typename std::enable_if<
+        hana::Struct<S>::value &&
+        std::is_same<typename hana::tag_of<S>::type, S>::value
+    >::type>
+        : bitwise_comparable_members<S, decltype(hana::accessors<S>())>
+    { };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_STRUCT_LAYOUT_HPP
@@ -0,0 +1,71 @@
+/*!
+@file
+Defines `boost::hana::detail::type_at`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_TYPE_AT_HPP
+#define BOOST_HANA_DETAIL_TYPE_AT_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    // type_pack:
+    //  Holds a pack of types and provides constant-time access to the n-th
+    //  type through `type_pack<T...>::at<n>`. When the compiler provides a
+    //  pack-indexing intrinsic, it is used directly. Otherwise, `type_pack`
+    //  inherits from one `type_at_detail::elt<i, T>` per type, and the n-th
+    //  type is found by overload resolution on that base. In that case, the
+    //  bases are only instantiated once per `type_pack`, so several lookups
+    //  in the same pack should go through the same `type_pack`.
+    //
+    // type_at:
+    //  Shortcut for a single lookup: `type_at<n, T...>` is the n-th type of
+    //  `T...`.
+#if defined(BOOST_HANA_TYPE_PACK_ELEMENT)
+    template <typename ...T>
+    struct type_pack {
+        template <std::size_t n>
+        using at = BOOST_HANA_TYPE_PACK_ELEMENT(n, T...);
+    };
+#else
+    namespace type_at_detail {
+        template <std::size_t i, typename T>
+        struct elt { using type = T; };
+
+        template <typename Indices, typename ...T>
+        struct indexer;
+
+        template <std::size_t ...i, typename ...T>
+        struct indexer<std::index_sequence<i...>, T...>
+            : elt<i, T>...
+        { };
+
+        template <std::size_t i, typename T>
+        elt<i, T> get_elt(elt<i, T> const&);
+    }
+
+    template <typename ...T>
+    struct type_pack
+        : type_at_detail::indexer<std::make_index_sequence<sizeof...(T)>, T...>
+    {
+        template <std::size_t n>
+        using at = typename decltype(
+            type_at_detail::get_elt<n>(std::declval<type_pack const&>())
+        )::type;
+    };
+#endif
+
+    template <std::size_t n, typename ...T>
+    using type_at = typename type_pack<T...>::template at<n>;
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_TYPE_AT_HPP
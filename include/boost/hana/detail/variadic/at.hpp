@@ -11,6 +11,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_DETAIL_VARIADIC_AT_HPP
 
 #include <boost/hana/config.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -28,9 +29,16 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
         { return nth; }
 
     public:
+        // When the type of the n-th argument can be found directly, we pass
+        // it explicitly to `go` so it does not have to be deduced.
         template <typename ...Xs>
-        constexpr auto operator()(Xs ...xs) const
-        { return *go(&xs...); }
+        constexpr auto operator()(Xs ...xs) const {
+#if defined(BOOST_HANA_TYPE_PACK_ELEMENT)
+            return *go<BOOST_HANA_TYPE_PACK_ELEMENT(n, Xs...)*>(&xs...);
+#else
+            return *go(&xs...);
+#endif
+        }
     };
 
     template <std::size_t n>
@@ -13,7 +13,6 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/equal.hpp>
 
 #include <boost/hana/accessors.hpp>
-#include <boost/hana/all_of.hpp>
 #include <boost/hana/and.hpp>
 #include <boost/hana/at.hpp>
 #include <boost/hana/bool.hpp>
@@ -31,7 +30,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/concepts.hpp>
 #include <boost/hana/detail/dependent_on.hpp>
 #include <boost/hana/detail/has_common_embedding.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
 #include <boost/hana/detail/nested_to.hpp> // required by fwd decl
+#include <boost/hana/detail/struct_layout.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/if.hpp>
 #include <boost/hana/length.hpp>
@@ -39,6 +40,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/value.hpp>
 
 #include <cstddef>
+#include <cstring>
+#include <type_traits>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -172,26 +175,89 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable for Structs
+    //////////////////////////////////////////////////////////////////////////
     namespace detail {
-        template <typename X, typename Y>
+        // Same as `compare_finite_sequences`, but for the members of Structs:
+        // this stops at the first pair of unequal members, and it produces a
+        // compile-time result if all the members are compared at compile-time.
+        template <typename X, typename Y, typename Accessors, std::size_t Length>
         struct compare_struct_members {
             X const& x;
             Y const& y;
+            Accessors const& accessors;
 
-            template <typename Member>
-            constexpr auto operator()(Member&& member) const {
-                auto accessor = hana::second(static_cast<Member&&>(member));
-                return hana::equal(accessor(x), accessor(y));
+            template <std::size_t i>
+            constexpr auto equal_at() const {
+                auto const& accessor = hana::second(hana::at_c<i>(accessors));
+                return hana::if_(hana::equal(accessor(x), accessor(y)),
+                                 hana::true_c, hana::false_c);
+            }
+
+            template <std::size_t i>
+            constexpr auto apply(hana::false_, hana::true_) const {
+                return compare_struct_members::apply<i+1>(
+                    hana::bool_c<i+1 == Length>,
+                    compare_struct_members::equal_at<i>()
+                );
+            }
+
+            template <std::size_t i>
+            constexpr auto apply(hana::false_, hana::false_) const
+            { return hana::false_c; }
+
+            template <std::size_t i, typename Result>
+            constexpr auto apply(hana::true_, Result r) const
+            { return r; }
+
+            template <std::size_t i>
+            constexpr bool apply(hana::false_, bool b) const {
+                return b && compare_struct_members::apply<i+1>(
+                    hana::bool_c<i+1 == Length>,
+                    compare_struct_members::equal_at<i>()
+                );
             }
         };
     }
 
     template <typename S>
     struct equal_impl<S, S, when<hana::Struct<S>::value>> {
+        template <typename X, typename Y>
+        static constexpr auto apply_impl(X const& x, Y const& y, hana::false_) {
+            auto accessors = hana::accessors<S>();
+            constexpr std::size_t length = decltype(hana::length(accessors))::value;
+            detail::compare_struct_members<X, Y, decltype(accessors), length>
+                comp{x, y, accessors};
+            return comp.template apply<0>(hana::bool_c<length == 0>, hana::true_c);
+        }
+
+        // When the members are the whole object and they are equal exactly
+        // when their bits are, a single `memcmp` is enough. This is only done
+        // when we can tell whether we're in a constant expression, since
+        // `memcmp` can't be used there.
+#if defined(BOOST_HANA_IS_CONSTANT_EVALUATED)
+        template <typename X, typename Y>
+        static constexpr bool apply_impl(X const& x, Y const& y, hana::true_) {
+            if (BOOST_HANA_IS_CONSTANT_EVALUATED())
+                return equal_impl::apply_impl(x, y, hana::false_c);
+            return std::memcmp(&x, &y, sizeof(S)) == 0;
+        }
+
+        template <typename X, typename Y>
+        using use_memcmp = typename std::conditional<
+            std::is_same<X, S>::value && std::is_same<Y, S>::value,
+            struct_detail::bitwise_comparable<S>, std::false_type
+        >::type;
+#else
+        template <typename X, typename Y>
+        using use_memcmp = std::false_type;
+#endif
+
         template <typename X, typename Y>
         static constexpr auto apply(X const& x, Y const& y) {
-            return hana::all_of(hana::accessors<S>(),
-                detail::compare_struct_members<X, Y>{x, y});
+            return equal_impl::apply_impl(x, y,
+                hana::bool_c<use_memcmp<X, Y>::value>);
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -0,0 +1,187 @@
+/*!
+@file
+Defines `boost::hana::experimental::dispatcher`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_DISPATCHER_HPP
+#define BOOST_HANA_EXPERIMENTAL_DISPATCHER_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/cartesian_product.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Constant-time runtime dispatch over the cartesian product of
+        //! several compile-time dimensions.
+        //!
+        //! Given a sequence of `Sequence`s (the dimensions) whose elements
+        //! are default-constructible compile-time entities such as
+        //! `hana::type`s or `IntegralConstant`s, a `dispatcher` holds a
+        //! flat table with one function pointer per element of their
+        //! `cartesian_product`. Each entry calls the function given to
+        //! `make_dispatcher` with the corresponding elements, followed by
+        //! the runtime arguments. The table is a `constexpr` array built
+        //! once per dispatcher type, so calling through a dispatcher is a
+        //! single indirect call, whatever the number of entries.
+        //!
+        //! Entries are indexed by a mixed-radix key, where the last dimension
+        //! varies the fastest, like in `hana::cartesian_product`. `key(i...)`
+        //! computes the key of the entry at index `i` in each dimension, and
+        //! `d(key, args...)` calls that entry. Calling a dispatcher with a key
+        //! that is not less than `size()` is undefined behavior.
+        //!
+        //! Example
+        //! -------
+        //! @code
+        //!     auto fill = hana::experimental::make_dispatcher<void(void*, std::size_t)>(
+        //!         hana::make_tuple(hana::tuple_t<float, double>, hana::range_c<int, 1, 4>),
+        //!         [](auto t, auto n, void* data, std::size_t size) { ... }
+        //!     );
+        //!     fill(fill.key(is_double, n - 1), data, size);
+        //! @endcode
+        template <typename Signature, typename F, typename ...Dimensions>
+        struct dispatcher;
+
+        //! @ingroup group-experimental
+        //! Creates a `dispatcher` with the given signature.
+        //!
+        //! `make_dispatcher<R(Args...)>(dimensions, f)` creates a dispatcher
+        //! over the elements of the sequence `dimensions`, which calls `f` as
+        //! `f(x1, ..., xn, args...)` and returns an `R`.
+        template <typename Signature>
+        struct make_dispatcher_t;
+
+        template <typename Signature>
+        constexpr make_dispatcher_t<Signature> make_dispatcher{};
+    }
+
+    namespace dispatch_detail {
+        template <typename Dimension, std::size_t i>
+        using element = typename detail::decay<
+            decltype(hana::at_c<i>(std::declval<Dimension const&>()))
+        >::type;
+
+        template <typename Dimension>
+        using length = decltype(hana::length(std::declval<Dimension const&>()));
+
+        template <typename ...Dimensions>
+        struct dimensions { };
+
+        // table:
+        //  Holds the function pointers of a dispatcher. `call<k>` decodes the
+        //  index of the `k`-th entry in each dimension, and calls the function
+        //  with default-constructed elements at those indices.
+        template <typename Signature, typename F, typename Dimensions,
+                  typename Keys = void>
+        struct table;
+
+        template <typename R, typename ...Args, typename F, typename ...D>
+        struct table<R(Args...), F, dimensions<D...>, void>
+            : table<R(Args...), F, dimensions<D...>, std::make_index_sequence<
+                hana::detail::cartesian_product_indices<length<D>::value...>::length
+            >>
+        { };
+
+        template <typename R, typename ...Args, typename F, typename ...D,
+                  std::size_t ...k>
+        struct table<R(Args...), F, dimensions<D...>, std::index_sequence<k...>> {
+            using Indices = hana::detail::cartesian_product_indices<length<D>::value...>;
+            using Pointer = R(*)(F const&, Args...);
+
+            static_assert(sizeof...(k) != 0,
+            "hana::experimental::make_dispatcher(dimensions, f) requires all "
+            "the dimensions to be non-empty");
+
+            template <std::size_t key, std::size_t ...d>
+            static R call_with(std::index_sequence<d...>, F const& f, Args&& ...args) {
+                constexpr auto indices = Indices::indices_of(key);
+                (void)indices; // workaround GCC warning when sizeof...(d) == 0
+                return f(element<D, indices[d]>{}..., static_cast<Args&&>(args)...);
+            }
+
+            template <std::size_t key>
+            static R call(F const& f, Args ...args) {
+                return call_with<key>(std::index_sequence_for<D...>{}, f,
+                                      static_cast<Args&&>(args)...);
+            }
+
+            static constexpr Pointer value[] = {&call<k>...};
+        };
+
+        template <typename R, typename ...Args, typename F, typename ...D,
+                  std::size_t ...k>
+        constexpr typename table<R(Args...), F, dimensions<D...>, std::index_sequence<k...>>::Pointer
+        table<R(Args...), F, dimensions<D...>, std::index_sequence<k...>>::value[];
+    }
+
+    namespace experimental {
+        //! @cond
+        template <typename R, typename ...Args, typename F, typename ...D>
+        struct dispatcher<R(Args...), F, D...> {
+            F f_;
+
+            static constexpr std::size_t size() {
+                return hana::detail::cartesian_product_indices<
+                    dispatch_detail::length<D>::value...
+                >::length;
+            }
+
+            template <typename ...I>
+            static constexpr std::size_t key(I ...i) {
+                static_assert(sizeof...(I) == sizeof...(D),
+                "hana::experimental::dispatcher::key(i...) requires one index "
+                "per dimension");
+                std::size_t const lengths[] = {dispatch_detail::length<D>::value..., 0};
+                std::size_t const indices[] = {static_cast<std::size_t>(i)..., 0};
+                std::size_t result = 0;
+                for (std::size_t j = 0; j != sizeof...(D); ++j)
+                    result = result * lengths[j] + indices[j];
+                return result;
+            }
+
+            R operator()(std::size_t key, Args ...args) const {
+                using Table = dispatch_detail::table<
+                    R(Args...), F, dispatch_detail::dimensions<D...>
+                >;
+                return Table::value[key](f_, static_cast<Args&&>(args)...);
+            }
+        };
+
+        template <typename Signature>
+        struct make_dispatcher_t {
+            template <typename F>
+            struct make {
+                F&& f;
+
+                template <typename ...Dimensions>
+                constexpr dispatcher<Signature, typename detail::decay<F>::type,
+                                     typename detail::decay<Dimensions>::type...>
+                operator()(Dimensions&& ...) const
+                { return {static_cast<F&&>(f)}; }
+            };
+
+            template <typename Dimensions, typename F>
+            constexpr auto operator()(Dimensions&& dimensions, F&& f) const {
+                return hana::unpack(static_cast<Dimensions&&>(dimensions),
+                                    make<F>{static_cast<F&&>(f)});
+            }
+        };
+        //! @endcond
+    }
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_DISPATCHER_HPP
@@ -0,0 +1,119 @@
+/*
+@file
+Defines `boost::hana::experimental::hash_value`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_HASH_VALUE_HPP
+#define BOOST_HANA_EXPERIMENTAL_HASH_VALUE_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <functional>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Returns a runtime hash of an object, combining the hashes of its
+    //! members for `Struct`s and of its elements for `Sequence`s.
+    //!
+    //! Unlike `hana::hash`, which computes a compile-time hash used to
+    //! implement `hana::map` and `hana::set`, `hash_value` returns a
+    //! `std::size_t` computed from the value of the object. For a `Struct`,
+    //! the hashes of the members are combined in the order of their
+    //! accessors; for a `Sequence`, the hashes of the elements are combined
+    //! in order. Both are applied recursively, and any other object is
+    //! hashed with `std::hash`. Objects that are equal as per `hana::equal`
+    //! have the same `hash_value`, provided this is true for `std::hash` on
+    //! their members.
+    //!
+    //! `hana::experimental::hasher` is a function object calling `hash_value`,
+    //! which can be used as the hash function of a standard unordered
+    //! container.
+    //!
+    //! @note
+    //! The hashes are combined the same way as `boost::hash_combine`, but
+    //! the resulting values are not meant to be the same as `boost::hash`.
+    struct hash_value_t {
+        template <typename X>
+        std::size_t operator()(X const& x) const;
+    };
+
+    constexpr hash_value_t hash_value{};
+
+    struct hasher {
+        template <typename X>
+        std::size_t operator()(X const& x) const
+        { return hana::experimental::hash_value(x); }
+    };
+
+    namespace hash_detail {
+        inline std::size_t combine(std::size_t seed, std::size_t h) {
+            return seed ^ (h + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        }
+
+        template <typename X>
+        struct hash_members {
+            X const& x;
+
+            template <typename ...Accessor>
+            std::size_t operator()(Accessor const& ...accessor) const {
+                std::size_t seed = 0;
+                using swallow = int[];
+                (void)swallow{0, (seed = hash_detail::combine(seed,
+                    hana::experimental::hash_value(hana::second(accessor)(x))
+                ), 0)...};
+                return seed;
+            }
+        };
+
+        struct hash_elements {
+            template <typename ...X>
+            std::size_t operator()(X const& ...x) const {
+                std::size_t seed = 0;
+                using swallow = int[];
+                (void)swallow{0, (seed = hash_detail::combine(seed,
+                    hana::experimental::hash_value(x)
+                ), 0)...};
+                return seed;
+            }
+        };
+
+        template <typename S, typename X>
+        std::size_t hash_value_impl(X const& x, hana::true_, hana::false_) {
+            return hana::unpack(hana::accessors<S>(), hash_members<X>{x});
+        }
+
+        template <typename S, typename X>
+        std::size_t hash_value_impl(X const& x, hana::false_, hana::true_)
+        { return hana::unpack(x, hash_elements{}); }
+
+        template <typename S, typename X>
+        std::size_t hash_value_impl(X const& x, hana::false_, hana::false_)
+        { return std::hash<X>{}(x); }
+    }
+
+    //! @cond
+    template <typename X>
+    std::size_t hash_value_t::operator()(X const& x) const {
+        using S = typename hana::tag_of<X>::type;
+        return hash_detail::hash_value_impl<S>(x,
+            hana::bool_c<hana::Struct<S>::value>,
+            hana::bool_c<hana::Sequence<S>::value && !hana::Struct<S>::value>
+        );
+    }
+    //! @endcond
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_HASH_VALUE_HPP
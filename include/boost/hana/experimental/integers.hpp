@@ -0,0 +1,381 @@
+/*!
+@file
+Defines `boost::hana::experimental::integers`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_INTEGERS_HPP
+#define BOOST_HANA_EXPERIMENTAL_INTEGERS_HPP
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/operators/adl.hpp>
+#include <boost/hana/detail/operators/comparable.hpp>
+#include <boost/hana/detail/operators/iterable.hpp>
+#include <boost/hana/ext/std/integer_sequence.hpp>
+#include <boost/hana/fwd/at.hpp>
+#include <boost/hana/fwd/concat.hpp>
+#include <boost/hana/fwd/contains.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/drop_back.hpp>
+#include <boost/hana/fwd/drop_front.hpp>
+#include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/filter.hpp>
+#include <boost/hana/fwd/find.hpp>
+#include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/is_empty.hpp>
+#include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/maximum.hpp>
+#include <boost/hana/fwd/minimum.hpp>
+#include <boost/hana/fwd/remove_at.hpp>
+#include <boost/hana/fwd/reverse.hpp>
+#include <boost/hana/fwd/sort.hpp>
+#include <boost/hana/fwd/sum.hpp>
+#include <boost/hana/fwd/take_front.hpp>
+#include <boost/hana/fwd/unique.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Container optimized for holding `hana::integral_constant`s of a
+        //! single type.
+        //!
+        //! `hana::tuple_c<T, v...>` is a tuple of distinct `integral_constant`
+        //! types, so algorithms like `sort`, `unique` and `maximum` compare
+        //! its elements pair by pair through `hana::less` and `hana::equal`.
+        //! Instead, `integers<T, v...>` keeps its values in a `constexpr`
+        //! array and its algorithms operate on that array. A pack of
+        //! `hana::integral_constant`s is only created when the container
+        //! is `unpack`ed.
+        //!
+        //! `integers` is `Comparable`, `Foldable`, `Iterable` and
+        //! `Searchable`. It also implements `sum`, `maximum`, `minimum`,
+        //! `sort`, `reverse`, `unique`, `filter`, `concat`, `take_front`,
+        //! `drop_back`, `insert` and `remove_at`, where the algorithms
+        //! returning a sequence return `integers`. Predicates are called
+        //! with `hana::integral_constant`s in an unevaluated context, so
+        //! they must return a compile-time `Logical`. Finally, any `Foldable`
+        //! of `IntegralConstant`s, such as a `tuple_c`, can be converted to
+        //! `integers` with `hana::to<experimental::integers_tag>`.
+        template <typename T, T ...v>
+        struct integers;
+
+        struct integers_tag;
+
+        //////////////////////////////////////////////////////////////////////
+
+        template <typename T, T ...v>
+        struct integers
+            : detail::operators::adl<integers<T, v...>>
+            , detail::iterable_operators<integers<T, v...>>
+        {
+            using value_type = T;
+        };
+    } // end namespace experimental
+
+    namespace detail {
+        template <>
+        struct comparable_operators<experimental::integers_tag> {
+            static constexpr bool value = true;
+        };
+    }
+
+    template <typename T, T ...v>
+    struct tag_of<experimental::integers<T, v...>> {
+        using type = experimental::integers_tag;
+    };
+
+    namespace integers_detail {
+        // The algorithms on `integers` are those of `std::integer_sequence`,
+        // which operate on a `constexpr` array of the values. These convert
+        // between the two representations.
+        template <typename T, T ...v>
+        constexpr hana::experimental::integers<T, v...>
+        from_sequence(std::integer_sequence<T, v...> const&) { return {}; }
+
+        template <typename T, T ...v>
+        constexpr std::integer_sequence<T, v...>
+        to_sequence(hana::experimental::integers<T, v...> const&) { return {}; }
+
+        using sequence_tag = hana::ext::std::integer_sequence_tag;
+
+        // predicate:
+        //  Wraps a predicate so it is called with `hana::integral_constant`s
+        //  instead of the `std::integral_constant`s of `integer_sequence`.
+        //  It is only ever called in an unevaluated context.
+        template <typename Pred>
+        struct predicate {
+            template <typename ...X>
+            auto operator()(X const& ...) const -> decltype(
+                std::declval<Pred const&>()(
+                    hana::integral_constant<typename X::value_type, X::value>{}...
+                )
+            );
+        };
+
+        // to_integers:
+        //  Function object meant to be `unpack`ed with a Foldable of
+        //  `IntegralConstant`s, returning the equivalent `integers`.
+        struct to_integers {
+            template <typename ...X>
+            constexpr auto operator()(X const& ...) const {
+                using T = typename std::common_type<
+                    typename hana::tag_of<X>::type::value_type...
+                >::type;
+                return hana::experimental::integers<T, static_cast<T>(X::value)...>{};
+            }
+
+            constexpr hana::experimental::integers<int> operator()() const
+            { return {}; }
+        };
+    }
+
+    // Conversion from any Foldable
+    template <typename F>
+    struct to_impl<experimental::integers_tag, F, when<hana::Foldable<F>::value>> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return hana::unpack(xs, integers_detail::to_integers{}); }
+    };
+
+    // Comparable
+    template <>
+    struct equal_impl<experimental::integers_tag, experimental::integers_tag> {
+        template <typename X, X ...xs, typename Y, Y ...ys>
+        static constexpr hana::bool_<detail::fast_and<(xs == ys)...>::value>
+        apply(experimental::integers<X, xs...> const&, experimental::integers<Y, ys...> const&)
+        { return {}; }
+
+        template <typename Xs, typename Ys>
+        static constexpr hana::false_ apply(Xs const&, Ys const&, ...)
+        { return {}; }
+    };
+
+    // Foldable
+    template <>
+    struct unpack_impl<experimental::integers_tag> {
+        template <typename T, T ...v, typename F>
+        static constexpr decltype(auto)
+        apply(experimental::integers<T, v...> const&, F&& f) {
+            return static_cast<F&&>(f)(hana::integral_constant<T, v>{}...);
+        }
+    };
+
+    template <>
+    struct length_impl<experimental::integers_tag> {
+        template <typename T, T ...v>
+        static constexpr hana::size_t<sizeof...(v)>
+        apply(experimental::integers<T, v...> const&)
+        { return {}; }
+    };
+
+    template <>
+    struct sum_impl<experimental::integers_tag> {
+        template <typename M, typename Xs>
+        static constexpr auto apply(Xs const& xs) {
+            return sum_impl<integers_detail::sequence_tag>::apply<M>(
+                integers_detail::to_sequence(xs));
+        }
+    };
+
+    template <>
+    struct maximum_impl<experimental::integers_tag> {
+        template <typename T, T ...v>
+        static constexpr auto apply(experimental::integers<T, v...> const& xs) {
+            using Max = decltype(maximum_impl<integers_detail::sequence_tag>::apply(
+                integers_detail::to_sequence(xs)));
+            return hana::integral_c<T, Max::value>;
+        }
+    };
+
+    template <>
+    struct minimum_impl<experimental::integers_tag> {
+        template <typename T, T ...v>
+        static constexpr auto apply(experimental::integers<T, v...> const& xs) {
+            using Min = decltype(minimum_impl<integers_detail::sequence_tag>::apply(
+                integers_detail::to_sequence(xs)));
+            return hana::integral_c<T, Min::value>;
+        }
+    };
+
+    // Iterable
+    template <>
+    struct at_impl<experimental::integers_tag> {
+        template <typename T, T ...v, typename N>
+        static constexpr auto apply(experimental::integers<T, v...> const&, N const&) {
+            using Values = detail::integer_sequence_values<T, v...>;
+            return hana::integral_c<T, Values::values[N::value]>;
+        }
+    };
+
+    template <>
+    struct is_empty_impl<experimental::integers_tag> {
+        template <typename T, T ...v>
+        static constexpr hana::bool_<sizeof...(v) == 0>
+        apply(experimental::integers<T, v...> const&)
+        { return {}; }
+    };
+
+    template <>
+    struct drop_front_impl<experimental::integers_tag> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs const& xs, N const& n) {
+            return integers_detail::from_sequence(
+                drop_front_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs), n));
+        }
+    };
+
+    // Searchable
+    template <>
+    struct contains_impl<experimental::integers_tag> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs const& xs, N const& n) {
+            return contains_impl<integers_detail::sequence_tag>::apply(
+                integers_detail::to_sequence(xs), n);
+        }
+    };
+
+    template <>
+    struct find_impl<experimental::integers_tag> {
+        template <typename T, T x>
+        static constexpr auto
+        to_hana(hana::optional<std::integral_constant<T, x>> const&)
+        { return hana::just(hana::integral_c<T, x>); }
+
+        static constexpr auto to_hana(hana::optional<> const&)
+        { return hana::nothing; }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs const& xs, N const& n) {
+            return find_impl::to_hana(find_impl<integers_detail::sequence_tag>::apply(
+                integers_detail::to_sequence(xs), n));
+        }
+    };
+
+    // Sequence-like algorithms
+    template <>
+    struct sort_impl<experimental::integers_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs) {
+            return integers_detail::from_sequence(
+                sort_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs)));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred const&) {
+            return integers_detail::from_sequence(
+                sort_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs),
+                    integers_detail::predicate<Pred>{}));
+        }
+    };
+
+    template <>
+    struct reverse_impl<experimental::integers_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs) {
+            return integers_detail::from_sequence(
+                reverse_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs)));
+        }
+    };
+
+    template <>
+    struct unique_impl<experimental::integers_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs) {
+            return integers_detail::from_sequence(
+                unique_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs)));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred const&) {
+            return integers_detail::from_sequence(
+                unique_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs),
+                    integers_detail::predicate<Pred>{}));
+        }
+    };
+
+    template <>
+    struct filter_impl<experimental::integers_tag> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred const&) {
+            return integers_detail::from_sequence(
+                filter_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs),
+                    integers_detail::predicate<Pred>{}));
+        }
+    };
+
+    template <>
+    struct concat_impl<experimental::integers_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const& xs, Ys const& ys) {
+            return integers_detail::from_sequence(
+                concat_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs),
+                    integers_detail::to_sequence(ys)));
+        }
+    };
+
+    template <>
+    struct take_front_impl<experimental::integers_tag> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs const& xs, N const& n) {
+            return integers_detail::from_sequence(
+                take_front_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs), n));
+        }
+    };
+
+    template <>
+    struct drop_back_impl<experimental::integers_tag> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs const& xs, N const& n) {
+            return integers_detail::from_sequence(
+                drop_back_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs), n));
+        }
+    };
+
+    template <>
+    struct insert_impl<experimental::integers_tag> {
+        template <typename Xs, typename N, typename Element>
+        static constexpr auto apply(Xs const& xs, N const& n, Element const& e) {
+            return integers_detail::from_sequence(
+                insert_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs), n, e));
+        }
+    };
+
+    template <>
+    struct remove_at_impl<experimental::integers_tag> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs const& xs, N const& n) {
+            return integers_detail::from_sequence(
+                remove_at_impl<integers_detail::sequence_tag>::apply(
+                    integers_detail::to_sequence(xs), n));
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_INTEGERS_HPP
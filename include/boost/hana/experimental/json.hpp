@@ -0,0 +1,824 @@
+/*!
+@file
+Defines `boost::hana::experimental::to_json` and
+`boost::hana::experimental::from_json`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_JSON_HPP
+#define BOOST_HANA_EXPERIMENTAL_JSON_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/fwd/map.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Appends the JSON representation of an object to a buffer.
+    //!
+    //! Given an object `x` and a buffer `out`, `to_json(x, out)` appends the
+    //! JSON representation of `x` to `out`, which can be any container of
+    //! `char`s supporting `push_back` and `insert(out.end(), first, last)`,
+    //! like `std::string` or `std::vector<char>`. Nothing is allocated except
+    //! by the buffer itself, which does not need to grow if enough memory
+    //! was reserved beforehand.
+    //!
+    //! The representation is defined recursively on the type of `x`:
+    //! - `bool`s are written as `true` or `false`
+    //! - other arithmetic types are written as numbers; floating point
+    //!   values that are not finite are written as `null`
+    //! - `std::string`s are written as strings, escaping what needs to be
+    //! - `Struct`s are written as objects whose keys are the names of their
+    //!   members, in the order of their accessors
+    //! - `hana::map`s whose keys are `hana::string`s are written as objects
+    //! - other `Sequence`s like `hana::tuple` are written as arrays
+    //! - a `hana::just(x)` is written as `x`, and `hana::nothing` as `null`
+    //!
+    //! The keys of `Struct`s and `hana::map`s must be `hana::string`s, which
+    //! are written without being escaped. The quoted keys are built at
+    //! compile-time, so that each one is written with a single copy.
+    struct to_json_t {
+        template <typename T, typename Buffer>
+        void operator()(T const& x, Buffer& out) const;
+    };
+
+    constexpr to_json_t to_json{};
+
+    //! @ingroup group-experimental
+    //! Reads an object from its JSON representation.
+    //!
+    //! Given an object `x` and a buffer `[first, last)` starting with the
+    //! JSON representation of an object of the same type as `x` (as written
+    //! by `to_json`, modulo whitespace), `from_json(x, first, last)` assigns
+    //! that object to `x` and returns a pointer past the end of what was
+    //! read. If the buffer does not start with such a representation,
+    //! `nullptr` is returned and the value of `x` is unspecified.
+    //!
+    //! The members of objects may appear in any order. Members that do not
+    //! correspond to any member of the `Struct` or `hana::map` being read
+    //! are skipped, and members of `x` that are not in the JSON object are
+    //! left untouched. The name of each member is looked up with a perfect
+    //! hash table built at compile-time from the keys, so that it costs one
+    //! hash and one comparison regardless of the number of keys.
+    //!
+    //! Nothing is allocated except by the `std::string`s inside `x`, when
+    //! they must grow to hold the strings that are read.
+    struct from_json_t {
+        template <typename T>
+        char const* operator()(T& x, char const* first, char const* last) const;
+    };
+
+    constexpr from_json_t from_json{};
+
+    namespace json_detail {
+        //////////////////////////////////////////////////////////////////////
+        // Perfect hashing of keys
+        //////////////////////////////////////////////////////////////////////
+        // FNV-1a, usable both at compile-time on the keys and at runtime on
+        // the input.
+        constexpr std::uint64_t hash(char const* s, std::size_t n) {
+            std::uint64_t h = 14695981039346656037ull;
+            for (std::size_t i = 0; i != n; ++i) {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+
+        constexpr std::size_t next_power_of_two(std::size_t n) {
+            std::size_t p = 1;
+            while (p < n)
+                p *= 2;
+            return p;
+        }
+
+        // Finalizer of splitmix64, which makes every bit of the result depend
+        // on every bit of `h`.
+        constexpr std::uint64_t mix(std::uint64_t h) {
+            h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+            h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+            return h ^ (h >> 31);
+        }
+
+        // perfect_hash:
+        //  Hash-and-displace table mapping the `N` keys whose hashes were
+        //  given to `make` to their index. Each key goes to a bucket given
+        //  by its hash, and each bucket has a displacement chosen so that
+        //  all the keys land in different slots. Since the displacement is
+        //  mixed with the hash, different displacements scatter the keys of
+        //  a bucket independently. Keys are placed starting with the largest
+        //  buckets, which are the hardest to place.
+        template <std::size_t N>
+        struct perfect_hash {
+            static constexpr std::size_t buckets = N == 0 ? 1 : N;
+            static constexpr std::size_t slots = json_detail::next_power_of_two(2 * N);
+            static constexpr std::uint32_t max_displacement = 1u << 16;
+
+            detail::array<std::uint32_t, buckets> displacement;
+            detail::array<std::size_t, slots> index;
+            bool ok;
+
+            static constexpr std::size_t bucket(std::uint64_t h)
+            { return static_cast<std::size_t>(h >> 32) % buckets; }
+
+            static constexpr std::size_t slot(std::uint64_t h, std::uint32_t d) {
+                return static_cast<std::size_t>(
+                    json_detail::mix(h + d * 0x9e3779b97f4a7c15ull)
+                ) & (slots - 1);
+            }
+
+            constexpr std::size_t find(std::uint64_t h) const
+            { return index[slot(h, displacement[bucket(h)])]; }
+
+            static constexpr perfect_hash make(detail::array<std::uint64_t, N> const& hashes) {
+                perfect_hash table{};
+                table.ok = true;
+                for (std::size_t s = 0; s != slots; ++s)
+                    table.index[s] = N;
+
+                // Group the keys by bucket, so that the keys of bucket `b`
+                // are `keys[first[b]]` to `keys[first[b+1]]` (exclusive).
+                detail::array<std::size_t, buckets + 1> first{};
+                for (std::size_t k = 0; k != N; ++k)
+                    ++first[bucket(hashes[k]) + 1];
+                std::size_t largest = 0;
+                for (std::size_t b = 0; b != buckets; ++b) {
+                    largest = first[b + 1] > largest ? first[b + 1] : largest;
+                    first[b + 1] += first[b];
+                }
+                detail::array<std::size_t, N> keys{};
+                detail::array<std::size_t, buckets> fill{};
+                for (std::size_t k = 0; k != N; ++k) {
+                    std::size_t b = bucket(hashes[k]);
+                    keys[first[b] + fill[b]++] = k;
+                }
+
+                for (std::size_t size = largest; size != 0; --size) {
+                    for (std::size_t b = 0; b != buckets; ++b) {
+                        if (first[b + 1] - first[b] != size)
+                            continue;
+                        std::uint32_t d = 0;
+                        while (d != max_displacement &&
+                               !table.place(hashes, keys.begin() + first[b], size, d))
+                            ++d;
+                        if (d == max_displacement)
+                            table.ok = false;
+                        table.displacement[b] = d;
+                    }
+                }
+                return table;
+            }
+
+            // Places the `n` keys of a bucket with displacement `d`, and
+            // returns whether they all landed in free slots. Otherwise, the
+            // table is left as it was.
+            constexpr bool place(detail::array<std::uint64_t, N> const& hashes,
+                                 std::size_t const* keys, std::size_t n,
+                                 std::uint32_t d)
+            {
+                for (std::size_t k = 0; k != n; ++k) {
+                    std::size_t s = slot(hashes[keys[k]], d);
+                    if (index[s] != N) {
+                        for (std::size_t j = 0; j != k; ++j)
+                            index[slot(hashes[keys[j]], d)] = N;
+                        return false;
+                    }
+                    index[s] = keys[k];
+                }
+                return true;
+            }
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Keys
+        //////////////////////////////////////////////////////////////////////
+        template <typename Key>
+        struct key {
+            static_assert(detail::wrong<Key>{},
+            "hana::experimental::to_json and from_json require the keys of "
+            "Structs and hana::maps to be hana::strings");
+        };
+
+        template <char ...c>
+        struct key<hana::string<c...>> {
+            static constexpr std::size_t size = sizeof...(c);
+
+            static constexpr char const* data()
+            { return hana::to<char const*>(hana::string<c...>{}); }
+
+            // The key as it is written, preceded by a comma for all keys but
+            // the first one.
+            using quoted = hana::string<',', '"', c..., '"', ':'>;
+
+            static constexpr char const* quoted_data(bool first)
+            { return hana::to<char const*>(quoted{}) + first; }
+
+            static constexpr std::size_t quoted_size(bool first)
+            { return sizeof...(c) + 4 - first; }
+        };
+
+        template <typename ...Key>
+        struct key_table {
+            static constexpr std::size_t size = sizeof...(Key);
+            using table_type = perfect_hash<size>;
+
+            static constexpr table_type table = table_type::make(
+                detail::array<std::uint64_t, size>{{
+                    json_detail::hash(key<Key>::data(), key<Key>::size)...
+                }}
+            );
+
+            // Returns the index of the key `[s, s + n)`, or `size` if it is
+            // not one of the keys.
+            static std::size_t find(char const* s, std::size_t n) {
+                static_assert(table.ok,
+                "hana::experimental::from_json could not build a perfect hash "
+                "table for the keys of a Struct or hana::map; this only happens "
+                "when two keys have the same 64-bit hash");
+
+                static constexpr char const* data[] = {key<Key>::data()..., ""};
+                static constexpr std::size_t sizes[] = {key<Key>::size..., 0};
+                std::size_t i = table.find(json_detail::hash(s, n));
+                if (i != size && (sizes[i] != n || std::memcmp(data[i], s, n) != 0))
+                    return size;
+                return i;
+            }
+        };
+
+        template <typename ...Key>
+        constexpr typename key_table<Key...>::table_type key_table<Key...>::table;
+
+        //////////////////////////////////////////////////////////////////////
+        // Writing and reading
+        //////////////////////////////////////////////////////////////////////
+        template <typename Buffer>
+        struct writer {
+            Buffer& out;
+
+            void put(char c)
+            { out.push_back(c); }
+
+            void write(char const* s, std::size_t n)
+            { out.insert(out.end(), s, s + n); }
+        };
+
+        struct reader {
+            char const* in;
+            char const* last;
+
+            void skip_whitespace() {
+                while (in != last && (*in == ' ' || *in == '\n' ||
+                                      *in == '\r' || *in == '\t'))
+                    ++in;
+            }
+
+            // Skips whitespace, and consumes `c` if it comes next.
+            bool consume(char c) {
+                skip_whitespace();
+                if (in == last || *in != c)
+                    return false;
+                ++in;
+                return true;
+            }
+
+            bool literal(char const* s, std::size_t n) {
+                skip_whitespace();
+                if (static_cast<std::size_t>(last - in) < n || std::memcmp(in, s, n) != 0)
+                    return false;
+                in += n;
+                return true;
+            }
+
+            // Reads a string without unescaping it, so that `[s, s + n)` is
+            // the string as it appears between the quotes.
+            bool raw_string(char const*& s, std::size_t& n) {
+                if (!consume('"'))
+                    return false;
+                s = in;
+                for (; in != last && *in != '"'; ++in) {
+                    if (*in == '\\' && ++in == last)
+                        return false;
+                }
+                if (in == last)
+                    return false;
+                n = static_cast<std::size_t>(in++ - s);
+                return true;
+            }
+
+            // Reads the characters that may appear in a number; whether
+            // they form a valid number is left to the caller.
+            bool number(char const*& s, std::size_t& n) {
+                skip_whitespace();
+                s = in;
+                while (in != last && ((*in >= '0' && *in <= '9') || *in == '-' ||
+                                      *in == '+' || *in == '.' || *in == 'e' || *in == 'E'))
+                    ++in;
+                n = static_cast<std::size_t>(in - s);
+                return n != 0;
+            }
+
+            // Skips any value, which is used for the members of objects that
+            // are not read.
+            bool skip_value() {
+                skip_whitespace();
+                if (in == last)
+                    return false;
+                char const* s;
+                std::size_t n;
+                switch (*in) {
+                    case '"': return raw_string(s, n);
+                    case 't': return literal("true", 4);
+                    case 'f': return literal("false", 5);
+                    case 'n': return literal("null", 4);
+                    case '[': return skip_sequence(']');
+                    case '{': return skip_sequence('}');
+                    default:  return number(s, n);
+                }
+            }
+
+            bool skip_sequence(char close) {
+                ++in;
+                if (consume(close))
+                    return true;
+                do {
+                    if (close == '}') {
+                        char const* s;
+                        std::size_t n;
+                        if (!raw_string(s, n) || !consume(':'))
+                            return false;
+                    }
+                    if (!skip_value())
+                        return false;
+                } while (consume(','));
+                return consume(close);
+            }
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Codecs
+        //////////////////////////////////////////////////////////////////////
+        // codec:
+        //  Defines the JSON representation of objects of type `T`.
+        template <typename T, typename = void>
+        struct codec : codec<T, hana::when<true>> { };
+
+        template <typename T, bool condition>
+        struct codec<T, hana::when<condition>> {
+            static_assert(condition,
+            "hana::experimental::to_json and from_json require their argument "
+            "to be made of arithmetic types, std::strings, Structs, hana::maps, "
+            "hana::optionals and Sequences");
+        };
+
+        template <>
+        struct codec<bool> {
+            template <typename Buffer>
+            static void encode(writer<Buffer>& w, bool x) {
+                if (x) w.write("true", 4);
+                else   w.write("false", 5);
+            }
+
+            static bool decode(reader& r, bool& x) {
+                r.skip_whitespace();
+                x = r.in != r.last && *r.in == 't';
+                return x ? r.literal("true", 4) : r.literal("false", 5);
+            }
+        };
+
+        template <typename T>
+        struct codec<T, hana::when<std::is_integral<T>::value &&
+                                   !std::is_same<T, bool>::value>> {
+            using Unsigned = typename std::make_unsigned<T>::type;
+
+            template <typename Buffer>
+            static void encode(writer<Buffer>& w, T x) {
+                char buffer[std::numeric_limits<Unsigned>::digits10 + 2];
+                char* first = buffer + sizeof(buffer);
+                Unsigned n = x < 0 ? Unsigned(0) - static_cast<Unsigned>(x)
+                                   : static_cast<Unsigned>(x);
+                do *--first = static_cast<char>('0' + n % 10);
+                while (n /= 10);
+                if (x < 0)
+                    w.put('-');
+                w.write(first, static_cast<std::size_t>(buffer + sizeof(buffer) - first));
+            }
+
+            static bool decode(reader& r, T& x) {
+                char const* s;
+                std::size_t n;
+                if (!r.number(s, n))
+                    return false;
+                bool negative = *s == '-';
+                if (negative && (!std::is_signed<T>::value || --n == 0))
+                    return false;
+                s += negative;
+
+                Unsigned limit = negative ? Unsigned(0) - static_cast<Unsigned>(std::numeric_limits<T>::min())
+                                          : static_cast<Unsigned>(std::numeric_limits<T>::max());
+                Unsigned value = 0;
+                for (std::size_t i = 0; i != n; ++i) {
+                    if (s[i] < '0' || s[i] > '9')
+                        return false;
+                    Unsigned digit = static_cast<Unsigned>(s[i] - '0');
+                    if (value > (limit - digit) / 10)
+                        return false;
+                    value = static_cast<Unsigned>(value * 10 + digit);
+                }
+                x = negative ? static_cast<T>(Unsigned(0) - value) : static_cast<T>(value);
+                return true;
+            }
+        };
+
+        template <typename T>
+        struct codec<T, hana::when<std::is_floating_point<T>::value>> {
+            template <typename Buffer>
+            static void encode(writer<Buffer>& w, T x) {
+                if (!std::isfinite(x))
+                    return w.write("null", 4);
+                char buffer[32];
+                int n = std::snprintf(buffer, sizeof(buffer), "%.*Lg",
+                    std::numeric_limits<T>::max_digits10, static_cast<long double>(x));
+                w.write(buffer, static_cast<std::size_t>(n));
+            }
+
+            // `std::strtold` requires a null-terminated string, so the number
+            // is copied to a local buffer before being converted.
+            static bool decode(reader& r, T& x) {
+                char const* s;
+                std::size_t n;
+                char buffer[64];
+                if (!r.number(s, n) || n >= sizeof(buffer))
+                    return false;
+                std::memcpy(buffer, s, n);
+                buffer[n] = '\0';
+                char* end;
+                x = static_cast<T>(std::strtold(buffer, &end));
+                return end == buffer + n;
+            }
+        };
+
+        template <typename Traits, typename Allocator>
+        struct codec<std::basic_string<char, Traits, Allocator>> {
+            using String = std::basic_string<char, Traits, Allocator>;
+
+            // Characters that do not need to be escaped are written in runs.
+            template <typename Buffer>
+            static void encode(writer<Buffer>& w, String const& x) {
+                static constexpr char hex[] = "0123456789abcdef";
+                w.put('"');
+                char const* run = x.data();
+                char const* last = x.data() + x.size();
+                for (char const* p = run; p != last; ++p) {
+                    unsigned char c = static_cast<unsigned char>(*p);
+                    if (c >= 0x20 && c != '"' && c != '\\')
+                        continue;
+                    w.write(run, static_cast<std::size_t>(p - run));
+                    run = p + 1;
+                    char escape[6] = {'\\', 0, '0', '0', hex[c >> 4], hex[c & 0xf]};
+                    switch (c) {
+                        case '"':  escape[1] = '"';  break;
+                        case '\\': escape[1] = '\\'; break;
+                        case '\b': escape[1] = 'b';  break;
+                        case '\f': escape[1] = 'f';  break;
+                        case '\n': escape[1] = 'n';  break;
+                        case '\r': escape[1] = 'r';  break;
+                        case '\t': escape[1] = 't';  break;
+                        default:   escape[1] = 'u';  break;
+                    }
+                    w.write(escape, escape[1] == 'u' ? 6 : 2);
+                }
+                w.write(run, static_cast<std::size_t>(last - run));
+                w.put('"');
+            }
+
+            static bool decode(reader& r, String& x) {
+                char const* s;
+                std::size_t n;
+                if (!r.raw_string(s, n))
+                    return false;
+                x.clear();
+                char const* last = s + n;
+                for (char const* run = s; ; ) {
+                    char const* escape = static_cast<char const*>(
+                        std::memchr(run, '\\', static_cast<std::size_t>(last - run)));
+                    if (escape == nullptr) {
+                        x.append(run, last);
+                        return true;
+                    }
+                    x.append(run, escape);
+                    if (!codec::unescape(x, escape, last))
+                        return false;
+                    run = escape;
+                }
+            }
+
+            // Appends the character escaped at `p` and moves `p` past it.
+            static bool unescape(String& x, char const*& p, char const* last) {
+                switch (*++p) {
+                    case '"': case '\\': case '/': x.push_back(*p); break;
+                    case 'b': x.push_back('\b'); break;
+                    case 'f': x.push_back('\f'); break;
+                    case 'n': x.push_back('\n'); break;
+                    case 'r': x.push_back('\r'); break;
+                    case 't': x.push_back('\t'); break;
+                    case 'u': {
+                        std::uint32_t c;
+                        if (!codec::code_unit(c, ++p, last))
+                            return false;
+                        if (c >= 0xd800 && c < 0xdc00) {
+                            std::uint32_t low;
+                            if (last - p < 2 || p[0] != '\\' || p[1] != 'u')
+                                return false;
+                            p += 2;
+                            if (!codec::code_unit(low, p, last) || low < 0xdc00 || low >= 0xe000)
+                                return false;
+                            c = 0x10000 + ((c - 0xd800) << 10) + (low - 0xdc00);
+                        }
+                        codec::utf8(x, c);
+                        return true;
+                    }
+                    default: return false;
+                }
+                ++p;
+                return true;
+            }
+
+            static bool code_unit(std::uint32_t& c, char const*& p, char const* last) {
+                if (last - p < 4)
+                    return false;
+                c = 0;
+                for (char const* end = p + 4; p != end; ++p) {
+                    c <<= 4;
+                    if      (*p >= '0' && *p <= '9') c |= static_cast<std::uint32_t>(*p - '0');
+                    else if (*p >= 'a' && *p <= 'f') c |= static_cast<std::uint32_t>(*p - 'a' + 10);
+                    else if (*p >= 'A' && *p <= 'F') c |= static_cast<std::uint32_t>(*p - 'A' + 10);
+                    else return false;
+                }
+                return true;
+            }
+
+            static void utf8(String& x, std::uint32_t c) {
+                if (c < 0x80) {
+                    x.push_back(static_cast<char>(c));
+                } else if (c < 0x800) {
+                    x.push_back(static_cast<char>(0xc0 | (c >> 6)));
+                    x.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+                } else if (c < 0x10000) {
+                    x.push_back(static_cast<char>(0xe0 | (c >> 12)));
+                    x.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+                    x.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+                } else {
+                    x.push_back(static_cast<char>(0xf0 | (c >> 18)));
+                    x.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3f)));
+                    x.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+                    x.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+                }
+            }
+        };
+
+        template <typename T>
+        struct codec<T, hana::when<std::is_same<
+            typename hana::tag_of<T>::type, hana::optional_tag
+        >::value>> {
+            template <typename Buffer>
+            static void encode(writer<Buffer>& w, T const& x)
+            { codec::encode_impl(w, x, hana::is_nothing(x)); }
+
+            template <typename Buffer>
+            static void encode_impl(writer<Buffer>& w, T const&, hana::true_)
+            { w.write("null", 4); }
+
+            template <typename Buffer>
+            static void encode_impl(writer<Buffer>& w, T const& x, hana::false_)
+            { codec<typename detail::decay<decltype(*x)>::type>::encode(w, *x); }
+
+            static bool decode(reader& r, T& x)
+            { return codec::decode_impl(r, x, hana::is_nothing(x)); }
+
+            static bool decode_impl(reader& r, T&, hana::true_)
+            { return r.literal("null", 4); }
+
+            static bool decode_impl(reader& r, T& x, hana::false_)
+            { return codec<typename detail::decay<decltype(*x)>::type>::decode(r, *x); }
+        };
+
+        // record:
+        //  Codec for the objects that are represented as JSON objects, whose
+        //  `Fields::size` members are given by `Fields`. `Fields::keys` is a
+        //  `key_table` over the keys of the members, `Fields::key_at<i>` is
+        //  the key of the `i`-th member, and `Fields::get<i>(x)` returns it.
+        template <typename T, typename Fields>
+        struct record {
+            // The table is only built when decoding, not when encoding.
+            static constexpr std::size_t size = Fields::size;
+
+            template <typename Buffer>
+            struct encode_fields {
+                writer<Buffer>& w;
+                T const& x;
+
+                template <std::size_t i>
+                void encode() const {
+                    using Key = key<typename Fields::template key_at<i>>;
+                    w.write(Key::quoted_data(i == 0), Key::quoted_size(i == 0));
+                    auto const& member = Fields::template get<i>(x);
+                    codec<typename detail::decay<decltype(member)>::type>::encode(w, member);
+                }
+
+                template <std::size_t ...i>
+                void operator()(std::index_sequence<i...>) const {
+                    using swallow = int[];
+                    (void)swallow{0, (encode_fields::encode<i>(), 0)...};
+                }
+            };
+
+            template <typename Buffer>
+            static void encode(writer<Buffer>& w, T const& x) {
+                w.put('{');
+                encode_fields<Buffer>{w, x}(std::make_index_sequence<size>{});
+                w.put('}');
+            }
+
+            template <std::size_t i>
+            static bool decode_member(reader& r, T& x) {
+                using Member = decltype(Fields::template get<i>(x));
+                static_assert(std::is_lvalue_reference<Member>::value,
+                "hana::experimental::from_json requires the accessors of a "
+                "Struct to return references to its members");
+                return codec<typename detail::decay<Member>::type>::decode(
+                    r, Fields::template get<i>(x));
+            }
+
+            static bool skip_field(reader& r, T&)
+            { return r.skip_value(); }
+
+            // The field is read through a table of functions indexed by the
+            // position of the key, whose last entry skips unknown fields.
+            template <std::size_t ...i>
+            static bool decode_field(reader& r, T& x, std::size_t index, std::index_sequence<i...>) {
+                using Decoder = bool(*)(reader&, T&);
+                static constexpr Decoder decoders[] = {
+                    &record::template decode_member<i>..., &record::skip_field
+                };
+                return decoders[index](r, x);
+            }
+
+            static bool decode(reader& r, T& x) {
+                if (!r.consume('{'))
+                    return false;
+                if (r.consume('}'))
+                    return true;
+                do {
+                    char const* key;
+                    std::size_t n;
+                    if (!r.raw_string(key, n) || !r.consume(':'))
+                        return false;
+                    if (!record::decode_field(r, x, Fields::keys::find(key, n),
+                                              std::make_index_sequence<size>{}))
+                        return false;
+                } while (r.consume(','));
+                return r.consume('}');
+            }
+        };
+
+        template <typename ...Key>
+        struct collect_keys {
+            static constexpr std::size_t size = sizeof...(Key);
+            using keys = key_table<Key...>;
+            template <std::size_t i>
+            using key_at = detail::type_at<i, Key...>;
+        };
+
+        struct collect_accessor_keys {
+            template <typename ...Accessor>
+            auto operator()(Accessor&& ...) const -> collect_keys<
+                typename detail::decay<decltype(hana::first(std::declval<Accessor>()))>::type...
+            >;
+        };
+
+        template <typename S>
+        struct struct_fields
+            : decltype(hana::unpack(hana::accessors<S>(), collect_accessor_keys{}))
+        {
+            template <std::size_t i, typename X>
+            static decltype(auto) get(X& x)
+            { return hana::second(hana::at_c<i>(hana::accessors<S>()))(x); }
+        };
+
+        template <typename M>
+        struct map_fields
+            : decltype(hana::unpack(std::declval<M&>(), collect_accessor_keys{}))
+        {
+            template <std::size_t i, typename X>
+            static decltype(auto) get(X& x)
+            { return hana::at_key(x, typename map_fields::template key_at<i>{}); }
+        };
+
+        template <typename S>
+        struct codec<S, hana::when<hana::Struct<S>::value>>
+            : record<S, struct_fields<typename hana::tag_of<S>::type>>
+        { };
+
+        template <typename M>
+        struct codec<M, hana::when<std::is_same<
+            typename hana::tag_of<M>::type, hana::map_tag
+        >::value>>
+            : record<M, map_fields<M>>
+        { };
+
+        template <typename S>
+        struct codec<S, hana::when<hana::Sequence<S>::value &&
+                                   !hana::Struct<S>::value>> {
+            template <typename Buffer>
+            struct encode_elements {
+                writer<Buffer>& w;
+
+                template <typename ...X>
+                void operator()(X const& ...x) const {
+                    bool first = true;
+                    using swallow = int[];
+                    (void)swallow{0, (first ? (void)(first = false) : w.put(','),
+                                      codec<X>::encode(w, x), 0)...};
+                    (void)first;
+                }
+            };
+
+            template <typename Buffer>
+            static void encode(writer<Buffer>& w, S const& xs) {
+                w.put('[');
+                hana::unpack(xs, encode_elements<Buffer>{w});
+                w.put(']');
+            }
+
+            struct decode_elements {
+                reader& r;
+
+                template <typename ...X>
+                bool operator()(X& ...x) const {
+                    bool ok = true, first = true;
+                    using swallow = int[];
+                    (void)swallow{0, (ok = ok && (first ? (first = false, true) : r.consume(','))
+                                              && codec<X>::decode(r, x), 0)...};
+                    (void)first;
+                    return ok;
+                }
+            };
+
+            static bool decode(reader& r, S& xs) {
+                return r.consume('[') &&
+                       hana::unpack(xs, decode_elements{r}) &&
+                       r.consume(']');
+            }
+        };
+    }
+
+    //! @cond
+    template <typename T, typename Buffer>
+    void to_json_t::operator()(T const& x, Buffer& out) const {
+        json_detail::writer<Buffer> w{out};
+        json_detail::codec<T>::encode(w, x);
+    }
+
+    template <typename T>
+    char const* from_json_t::operator()(T& x, char const* first, char const* last) const {
+        json_detail::reader r{first, last};
+        if (!json_detail::codec<T>::decode(r, x))
+            return nullptr;
+        return r.in;
+    }
+    //! @endcond
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_JSON_HPP
@@ -0,0 +1,387 @@
+/*!
+@file
+Defines `boost::hana::experimental::packed_layout` and
+`boost::hana::experimental::packed_tuple`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_PACKED_TUPLE_HPP
+#define BOOST_HANA_EXPERIMENTAL_PACKED_TUPLE_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace packed_detail {
+        // layout_info:
+        //  The result of `compute_layout`. `order[p]` is the index of the
+        //  element stored at position `p`, `indices[i]` is the position at
+        //  which the `i`-th element is stored, and `offsets[i]` is the byte
+        //  offset of the `i`-th element.
+        template <std::size_t N>
+        struct layout_info {
+            detail::array<std::size_t, N> order;
+            detail::array<std::size_t, N> indices;
+            detail::array<std::size_t, N> offsets;
+            std::size_t size;
+            std::size_t alignment;
+        };
+
+        // compute_layout:
+        //  Since the size of a type is always a multiple of its alignment,
+        //  and alignments are powers of two, storing the elements by
+        //  decreasing alignment leaves no padding between them; only the
+        //  padding at the end, which is needed anyway, remains. The sort is
+        //  stable, so elements with the same alignment keep their relative
+        //  order.
+        template <std::size_t N>
+        constexpr layout_info<N>
+        compute_layout(detail::array<std::size_t, N> const& sizes,
+                       detail::array<std::size_t, N> const& alignments)
+        {
+            layout_info<N> layout{};
+            for (std::size_t i = 0; i != N; ++i)
+                layout.order[i] = i;
+
+            for (std::size_t i = 1; i < N; ++i) {
+                for (std::size_t j = i; j != 0; --j) {
+                    std::size_t& a = layout.order[j - 1];
+                    std::size_t& b = layout.order[j];
+                    if (alignments[a] >= alignments[b])
+                        break;
+                    detail::constexpr_swap(a, b);
+                }
+            }
+
+            std::size_t offset = 0;
+            layout.alignment = 1;
+            for (std::size_t p = 0; p != N; ++p) {
+                std::size_t i = layout.order[p];
+                layout.indices[i] = p;
+                layout.offsets[i] = offset;
+                offset += sizes[i];
+                if (alignments[i] > layout.alignment)
+                    layout.alignment = alignments[i];
+            }
+            layout.size = (offset + layout.alignment - 1)
+                                / layout.alignment * layout.alignment;
+            return layout;
+        }
+
+        // References are stored as pointers for the purpose of the layout.
+        template <typename T>
+        using stored = typename std::conditional<std::is_reference<T>::value,
+            typename std::remove_reference<T>::type*, T
+        >::type;
+
+        template <typename ...T>
+        struct layout {
+            static constexpr layout_info<sizeof...(T)> value =
+                packed_detail::compute_layout<sizeof...(T)>(
+                    {{sizeof(stored<T>)...}}, {{alignof(stored<T>)...}}
+                );
+        };
+
+        template <typename ...T>
+        constexpr layout_info<sizeof...(T)> layout<T...>::value;
+
+        template <typename ...T>
+        using indices_for = std::make_index_sequence<sizeof...(T)>;
+    }
+
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Layout of a structure holding objects of types `T...` with as
+        //! little padding as possible.
+        //!
+        //! `packed_layout_of` has no runtime state; all of its members are
+        //! `IntegralConstant`s or tuples thereof:
+        //! - `order` holds, for each position in the structure, the index
+        //!   of the element stored there.
+        //! - `indices` holds, for each element, the position where it is
+        //!   stored. It is the inverse permutation of `order`.
+        //! - `offsets` holds the byte offset of each element.
+        //! - `size` and `alignment` are those of the whole structure.
+        //!
+        //! The elements are stored by decreasing alignment, with elements
+        //! of the same alignment kept in their original order. Since a size
+        //! is always a multiple of the corresponding alignment, this leaves
+        //! no padding except at the very end of the structure. References
+        //! are laid out like pointers.
+        template <typename ...T>
+        struct packed_layout_of;
+
+        template <typename ...T>
+        struct packed_layout_of {
+        private:
+            using Layout = packed_detail::layout<T...>;
+
+            template <std::size_t ...i>
+            static hana::tuple<hana::size_t<Layout::value.order[i]>...>
+            make_order(std::index_sequence<i...>);
+
+            template <std::size_t ...i>
+            static hana::tuple<hana::size_t<Layout::value.indices[i]>...>
+            make_indices(std::index_sequence<i...>);
+
+            template <std::size_t ...i>
+            static hana::tuple<hana::size_t<Layout::value.offsets[i]>...>
+            make_offsets(std::index_sequence<i...>);
+
+            using Indices = packed_detail::indices_for<T...>;
+
+        public:
+            decltype(make_order(Indices{})) order;
+            decltype(make_indices(Indices{})) indices;
+            decltype(make_offsets(Indices{})) offsets;
+            hana::size_t<Layout::value.size> size;
+            hana::size_t<Layout::value.alignment> alignment;
+        };
+
+        //! @ingroup group-experimental
+        //! Computes the `packed_layout_of` a sequence of types.
+        //!
+        //! Given a `Foldable` of `hana::type`s, such as a `hana::tuple_t`,
+        //! `packed_layout` returns the `packed_layout_of` those types. The
+        //! whole layout is computed in a single `constexpr` evaluation.
+        struct packed_layout_fn;
+
+        //! @ingroup group-experimental
+        //! Tuple storing its elements in the order given by `packed_layout`.
+        //!
+        //! A `packed_tuple` is a `Sequence` that behaves exactly like a
+        //! `hana::tuple` with the same elements, except that its elements
+        //! are stored by decreasing alignment to minimize the padding
+        //! between them. Elements are always accessed in their original
+        //! order; the storage order is an implementation detail.
+        //!
+        //!
+        //! Modeled concepts
+        //! ----------------
+        //! `Sequence`, and all the concepts it refines
+        template <typename ...T>
+        struct packed_tuple;
+
+        //! Tag representing `experimental::packed_tuple`.
+        struct packed_tuple_tag { };
+
+        //! Alias to `make<packed_tuple_tag>`; provided for convenience.
+        constexpr auto make_packed_tuple = hana::make<packed_tuple_tag>;
+
+        //////////////////////////////////////////////////////////////////////
+
+    } // end namespace experimental
+
+    namespace packed_detail {
+        struct make_layout {
+            template <typename ...T>
+            constexpr experimental::packed_layout_of<typename T::type...>
+            operator()(T const& ...) const
+            { return {}; }
+        };
+    }
+
+    namespace experimental {
+        struct packed_layout_fn {
+            template <typename Types>
+            constexpr auto operator()(Types const& types) const
+            { return hana::unpack(types, packed_detail::make_layout{}); }
+        };
+
+        constexpr packed_layout_fn packed_layout{};
+    } // end namespace experimental
+
+    namespace packed_detail {
+        template <typename Order, typename ...T>
+        struct storage;
+
+        template <std::size_t ...p, typename ...T>
+        struct storage<std::index_sequence<p...>, T...> {
+            using type = hana::basic_tuple<
+                detail::type_at<p, T...>...
+            >;
+        };
+
+        template <typename ...T>
+        struct order {
+            template <std::size_t ...p>
+            static std::index_sequence<layout<T...>::value.order[p]...>
+            make(std::index_sequence<p...>);
+
+            using type = decltype(make(indices_for<T...>{}));
+        };
+
+        struct from_args { };
+    }
+
+    namespace experimental {
+        //! @cond
+        template <typename ...T>
+        struct packed_tuple {
+            using Order = typename packed_detail::order<T...>::type;
+            using Storage = typename packed_detail::storage<Order, T...>::type;
+
+            template <std::size_t ...p, typename Args>
+            constexpr packed_tuple(packed_detail::from_args,
+                                   std::index_sequence<p...>, Args&& args)
+                : storage_(hana::get_impl<p>(static_cast<Args&&>(args))...)
+            { }
+
+            constexpr packed_tuple() = default;
+
+            template <typename ...Yn, typename = typename std::enable_if<
+                sizeof...(Yn) == sizeof...(T) && sizeof...(T) != 0 &&
+                detail::fast_and<BOOST_HANA_TT_IS_CONSTRUCTIBLE(T, Yn&&)...>::value
+            >::type>
+            constexpr packed_tuple(Yn&& ...yn)
+                : packed_tuple(packed_detail::from_args{}, Order{},
+                               hana::basic_tuple<Yn&&...>(static_cast<Yn&&>(yn)...))
+            { }
+
+            Storage storage_;
+        };
+        //! @endcond
+    } // end namespace experimental
+
+    template <typename ...T>
+    struct tag_of<experimental::packed_tuple<T...>> {
+        using type = experimental::packed_tuple_tag;
+    };
+
+    namespace packed_detail {
+        template <std::size_t i, typename ...T, typename Xs>
+        constexpr decltype(auto) get(Xs&& xs) {
+            constexpr std::size_t p = layout<T...>::value.indices[i];
+            return hana::get_impl<p>(static_cast<Xs&&>(xs).storage_);
+        }
+
+        template <typename ...T, typename Xs, std::size_t ...i, typename F>
+        constexpr decltype(auto) unpack(Xs&& xs, std::index_sequence<i...>, F&& f) {
+            return static_cast<F&&>(f)(
+                packed_detail::get<i, T...>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs>
+        struct types_of;
+
+        template <typename ...T>
+        struct types_of<experimental::packed_tuple<T...>> {
+            template <std::size_t i, typename Xs>
+            static constexpr decltype(auto) get(Xs&& xs)
+            { return packed_detail::get<i, T...>(static_cast<Xs&&>(xs)); }
+
+            template <typename Xs, typename F>
+            static constexpr decltype(auto) unpack(Xs&& xs, F&& f) {
+                return packed_detail::unpack<T...>(static_cast<Xs&&>(xs),
+                    indices_for<T...>{}, static_cast<F&&>(f));
+            }
+
+            static constexpr std::size_t size = sizeof...(T);
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<experimental::packed_tuple_tag> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Types = packed_detail::types_of<typename detail::decay<Xs>::type>;
+            return Types::unpack(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct length_impl<experimental::packed_tuple_tag> {
+        template <typename ...T>
+        static constexpr auto apply(experimental::packed_tuple<T...> const&)
+        { return hana::size_c<sizeof...(T)>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct at_impl<experimental::packed_tuple_tag> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            using Types = packed_detail::types_of<typename detail::decay<Xs>::type>;
+            return Types::template get<N::value>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct drop_front_impl<experimental::packed_tuple_tag> {
+        template <std::size_t N, typename Xs, std::size_t ...i>
+        static constexpr auto drop_front_helper(Xs&& xs, std::index_sequence<i...>) {
+            using Types = packed_detail::types_of<typename detail::decay<Xs>::type>;
+            return experimental::make_packed_tuple(
+                Types::template get<i + N>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr std::size_t len = packed_detail::types_of<
+                typename detail::decay<Xs>::type
+            >::size;
+            return drop_front_helper<N::value>(static_cast<Xs&&>(xs), std::make_index_sequence<
+                N::value < len ? len - N::value : 0
+            >{});
+        }
+    };
+
+    template <>
+    struct is_empty_impl<experimental::packed_tuple_tag> {
+        template <typename ...T>
+        static constexpr auto apply(experimental::packed_tuple<T...> const&)
+        { return hana::bool_c<sizeof...(T) == 0>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct Sequence<experimental::packed_tuple_tag> {
+        static constexpr bool value = true;
+    };
+
+    template <>
+    struct make_impl<experimental::packed_tuple_tag> {
+        template <typename ...Xn>
+        static constexpr experimental::packed_tuple<typename detail::decay<Xn>::type...>
+        apply(Xn&& ...xn) {
+            return experimental::packed_tuple<typename detail::decay<Xn>::type...>{
+                static_cast<Xn&&>(xn)...
+            };
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_PACKED_TUPLE_HPP
@@ -18,9 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/for_each.hpp>
-#include <boost/hana/intersperse.hpp>
 #include <boost/hana/second.hpp>
-#include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 
 // models for different containers
@@ -32,10 +30,13 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/core/demangle.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <regex>
-#include <sstream>
+#include <streambuf>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 
@@ -60,19 +61,31 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     //! a `std::basic_ostream`. It can recursively print containers within
     //! containers, but do not expect any kind of proper indentation.
     //!
+    //! `print(x, os)` writes the representation of `x` to the `std::ostream`
+    //! `os` and returns `os`, and `print(x, out)` writes it to the output
+    //! iterator `out` and returns the iterator past the last character that
+    //! was written. Both write the representation as it is produced, without
+    //! building any intermediate string; `print(x)` is equivalent to writing
+    //! to a `std::back_inserter` into an empty `std::string`.
+    //!
     //! This function requires (the rest of) Boost to be available on the
     //! system. It also requires RTTI to be enabled.
 #ifdef BOOST_HANA_DOXYGEN_INVOKED
-    auto print = [](auto const& x) -> std::string {
+    auto print = [](auto const& x, ...) -> std::string {
         return tag-dispatched;
     };
 #else
     struct print_t {
         template <typename T>
-        std::string operator()(T const& t) const {
-            using Print = print_impl<typename hana::tag_of<T>::type>;
-            return Print::apply(t);
-        }
+        std::string operator()(T const& t) const;
+
+        template <typename T>
+        std::ostream& operator()(T const& t, std::ostream& os) const;
+
+        template <typename T, typename OutputIterator, typename = typename std::enable_if<
+            !std::is_base_of<std::ios_base, OutputIterator>::value
+        >::type>
+        OutputIterator operator()(T const& t, OutputIterator out) const;
     };
 
     constexpr print_t print{};
@@ -86,23 +99,114 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     };
 
     namespace print_detail {
-        std::string strip_type_junk(std::string const& str) {
+        inline std::string strip_type_junk(std::string const& str) {
             return std::regex_replace(str, std::regex("^([a-z_]+::)*([a-z_]*)_t<"), "$2<");
         }
+
+        // Demangling a name is expensive, so it is only done once per type.
+        template <typename T>
+        std::string const& demangled_name() {
+            static std::string const name = boost::core::demangle(typeid(T).name());
+            return name;
+        }
+
+        template <typename T>
+        std::string const& stripped_name() {
+            static std::string const name = strip_type_junk(demangled_name<T>());
+            return name;
+        }
+
+        // Models of `Printable` write to the stream they are given. For
+        // backward compatibility, models whose `apply` returns a string
+        // instead are also supported.
+        template <typename Print, typename T>
+        auto print_to(std::ostream& os, T const& t, int)
+            -> decltype(Print::apply(os, t), void())
+        { Print::apply(os, t); }
+
+        template <typename Print, typename T>
+        void print_to(std::ostream& os, T const& t, long)
+        { os << Print::apply(t); }
+
+        template <typename T>
+        void print_to(std::ostream& os, T const& t) {
+            using Print = print_impl<typename hana::tag_of<T>::type>;
+            print_detail::print_to<Print>(os, t, int{0});
+        }
+
+        struct print_separated {
+            std::ostream& os;
+            char const* separator;
+            bool first;
+
+            template <typename T>
+            void operator()(T const& t) {
+                if (!first)
+                    os << separator;
+                first = false;
+                print_detail::print_to(os, t);
+            }
+        };
+
+        // Stream buffer writing to an output iterator, so that the models
+        // of `Printable` can always write to a `std::ostream`.
+        template <typename OutputIterator>
+        struct iterator_buffer : std::streambuf {
+            OutputIterator out;
+            char buffer[256];
+
+            explicit iterator_buffer(OutputIterator it) : out(it)
+            { this->setp(buffer, buffer + sizeof(buffer)); }
+
+            int_type overflow(int_type c) override {
+                this->sync();
+                if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                    *this->pptr() = traits_type::to_char_type(c);
+                    this->pbump(1);
+                }
+                return traits_type::not_eof(c);
+            }
+
+            int sync() override {
+                out = std::copy(this->pbase(), this->pptr(), out);
+                this->setp(buffer, buffer + sizeof(buffer));
+                return 0;
+            }
+        };
+    }
+
+    //! @cond
+    template <typename T>
+    std::string print_t::operator()(T const& t) const {
+        std::string result;
+        (*this)(t, std::back_inserter(result));
+        return result;
     }
 
+    template <typename T>
+    std::ostream& print_t::operator()(T const& t, std::ostream& os) const {
+        print_detail::print_to(os, t);
+        return os;
+    }
+
+    template <typename T, typename OutputIterator, typename>
+    OutputIterator print_t::operator()(T const& t, OutputIterator out) const {
+        print_detail::iterator_buffer<OutputIterator> buffer{out};
+        std::ostream os(&buffer);
+        print_detail::print_to(os, t);
+        buffer.pubsync();
+        return buffer.out;
+    }
+    //! @endcond
+
     // model for Sequences
     template <typename S>
     struct print_impl<S, hana::when<hana::Sequence<S>::value>> {
         template <typename Xs>
-        static std::string apply(Xs const& xs) {
-            std::string result = "(";
-            auto comma_separated = hana::intersperse(xs, ", ");
-            hana::for_each(comma_separated, [&result](auto const& x) {
-                result += hana::experimental::print(x);
-            });
-            result += ")";
-            return result;
+        static void apply(std::ostream& os, Xs const& xs) {
+            os << '(';
+            hana::for_each(xs, print_detail::print_separated{os, ", ", true});
+            os << ')';
         }
     };
 
@@ -110,47 +214,51 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     //! @cond
     template <typename S>
     struct print_impl<S, hana::when_valid<decltype(
-        std::declval<std::ostringstream&>() << std::declval<S const&>()
+        std::declval<std::ostream&>() << std::declval<S const&>()
     )>> {
         template <typename T>
-        static std::string apply(T const& t) {
-            std::ostringstream os;
-            os << t;
-            return os.str();
-        }
+        static void apply(std::ostream& os, T const& t)
+        { os << t; }
     };
     //! @endcond
 
     // model for hana::optional
     template <>
     struct print_impl<hana::optional_tag> {
-        template <typename O>
-        static std::string apply(O const& optional) {
-            return hana::maybe("nothing",
-                [](auto const& x) {
-                    return "just(" + hana::experimental::print(x) + ")";
-                }, optional);
+        static void apply(std::ostream& os, hana::optional<> const&)
+        { os << "nothing"; }
+
+        template <typename T>
+        static void apply(std::ostream& os, hana::optional<T> const& optional) {
+            os << "just(";
+            print_detail::print_to(os, *optional);
+            os << ')';
         }
     };
 
     // model for hana::maps
     template <>
     struct print_impl<hana::map_tag> {
+        struct print_pairs {
+            std::ostream& os;
+            bool first;
+
+            template <typename Pair>
+            void operator()(Pair const& pair) {
+                if (!first)
+                    os << ", ";
+                first = false;
+                print_detail::print_to(os, hana::first(pair));
+                os << " => ";
+                print_detail::print_to(os, hana::second(pair));
+            }
+        };
+
         template <typename M>
-        static std::string apply(M const& map) {
-            std::string result = "{";
-            auto pairs = hana::transform(hana::to_tuple(map),
-                [](auto const& pair) {
-                    return hana::experimental::print(hana::first(pair))
-                        + " => "
-                        + hana::experimental::print(hana::second(pair));
-                });
-            auto comma_separated = hana::intersperse(pairs, ", ");
-            hana::for_each(comma_separated, [&result](auto const& element) {
-                result += element;
-            });
-            result += "}";
-            return result;
+        static void apply(std::ostream& os, M const& map) {
+            os << '{';
+            hana::for_each(map, print_pairs{os, true});
+            os << '}';
         }
     };
 
@@ -158,18 +266,16 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     template <template <typename ...> class F>
     struct print_impl<hana::metafunction_t<F>> {
         template <typename T>
-        static std::string apply(T const&) {
-            return print_detail::strip_type_junk(boost::core::demangle(typeid(T).name()));
-        }
+        static void apply(std::ostream& os, T const&)
+        { os << print_detail::stripped_name<T>(); }
     };
 
     // model for hana::metafunction_classes
     template <typename F>
     struct print_impl<hana::metafunction_class_t<F>> {
         template <typename T>
-        static std::string apply(T const&) {
-            return print_detail::strip_type_junk(boost::core::demangle(typeid(T).name()));
-        }
+        static void apply(std::ostream& os, T const&)
+        { os << print_detail::stripped_name<T>(); }
     };
 
     // model for Constants holding a `Printable`
@@ -179,9 +285,9 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
         Printable<typename C::value_type>::value
     >> {
         template <typename T>
-        static std::string apply(T const&) {
+        static void apply(std::ostream& os, T const&) {
             constexpr auto value = hana::value<T>();
-            return hana::experimental::print(value);
+            print_detail::print_to(os, value);
         }
     };
 
@@ -189,10 +295,12 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     template <typename P>
     struct print_impl<P, hana::when<hana::Product<P>::value>> {
         template <typename T>
-        static std::string apply(T const& t) {
-            return '(' + hana::experimental::print(hana::first(t))
-                    + ", "
-                    + hana::experimental::print(hana::second(t)) + ')';
+        static void apply(std::ostream& os, T const& t) {
+            os << '(';
+            print_detail::print_to(os, hana::first(t));
+            os << ", ";
+            print_detail::print_to(os, hana::second(t));
+            os << ')';
         }
     };
 
@@ -200,25 +308,18 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     template <>
     struct print_impl<hana::string_tag> {
         template <typename S>
-        static std::string apply(S const& s) {
-            return '"' + std::string{hana::to<char const*>(s)} + '"';
-        }
+        static void apply(std::ostream& os, S const& s)
+        { os << '"' << hana::to<char const*>(s) << '"'; }
     };
 
     // model for hana::sets
     template <>
     struct print_impl<hana::set_tag> {
         template <typename S>
-        static std::string apply(S const& set) {
-            std::string result = "{";
-            auto as_tuple = hana::transform(hana::to_tuple(set),
-                                hana::experimental::print);
-            auto comma_separated = hana::intersperse(as_tuple, ", ");
-            hana::for_each(comma_separated, [&result](auto const& element) {
-                result += element;
-            });
-            result += "}";
-            return result;
+        static void apply(std::ostream& os, S const& set) {
+            os << '{';
+            hana::for_each(set, print_detail::print_separated{os, ", ", true});
+            os << '}';
         }
     };
 
@@ -226,18 +327,17 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     template <template <typename ...> class F>
     struct print_impl<template_t<F>> {
         template <typename T>
-        static std::string apply(T const&) {
-            return print_detail::strip_type_junk(boost::core::demangle(typeid(T).name()));
-        }
+        static void apply(std::ostream& os, T const&)
+        { os << print_detail::stripped_name<T>(); }
     };
 
     // model for hana::types
     template <>
     struct print_impl<hana::type_tag> {
         template <typename T>
-        static std::string apply(T const&) {
+        static void apply(std::ostream& os, T const&) {
             using Type = typename T::type;
-            return "type<" + boost::core::demangle(typeid(Type).name()) + '>';
+            os << "type<" << print_detail::demangled_name<Type>() << '>';
         }
     };
 } BOOST_HANA_NAMESPACE_END
@@ -0,0 +1,581 @@
+/*!
+@file
+Defines `boost::hana::experimental::serialize` and related utilities.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_SERIALIZE_HPP
+#define BOOST_HANA_EXPERIMENTAL_SERIALIZE_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Writes a binary representation of an object into a buffer.
+    //!
+    //! Given an object `x` and a buffer `[first, last)`, `serialize(x,
+    //! first, last)` writes the representation of `x` at the beginning of
+    //! the buffer and returns a pointer to the end of what was written. If
+    //! the buffer is too small, nothing is written and `nullptr` is returned.
+    //! The size of the representation of `x` is `serialized_size(x)`, and
+    //! `deserialize` reads it back.
+    //!
+    //! The representation is defined recursively on the type of `x`:
+    //! - arithmetic and enumeration types are written as their object
+    //!   representation, i.e. in the byte order and size of the machine
+    //! - `Struct`s are written as the sequence of their members, in the
+    //!   order of their accessors
+    //! - `Sequence`s like `hana::tuple` are written as the sequence of their
+    //!   elements
+    //! - `std::array`s are written as the sequence of their elements
+    //! - `std::vector`s are written as their number of elements, encoded as
+    //!   a `std::uint64_t`, followed by the sequence of their elements;
+    //!   this includes `std::vector<bool>`, whose elements are written as
+    //!   `bool`s and not as bits
+    //!
+    //! There is no padding and no tag of any kind, so the layout is entirely
+    //! determined by the type. In particular, the representation is not
+    //! meant to be portable across platforms. The layout is known at compile
+    //! time, which is used to copy consecutive members that are also
+    //! consecutive in memory (e.g. the `int`s of a `struct` without padding,
+    //! or the contents of a `std::vector<int>`) with a single `std::memcpy`.
+    //! No memory is allocated, and the size of the buffer is checked only
+    //! once before anything is written.
+    //!
+    //! @note
+    //! `Struct`s whose accessors do not return references can be serialized,
+    //! but not deserialized.
+    struct serialize_t {
+        template <typename T>
+        char* operator()(T const& x, char* first, char* last) const;
+    };
+
+    constexpr serialize_t serialize{};
+
+    //! @ingroup group-experimental
+    //! Reads an object written by `serialize` from a buffer.
+    //!
+    //! Given an object `x` and a buffer `[first, last)` starting with the
+    //! representation of an object of the same type, `deserialize(x, first,
+    //! last)` assigns that object to `x` and returns a pointer to the end of
+    //! what was read. If the buffer ends before the representation does,
+    //! `nullptr` is returned and the value of `x` is unspecified. Only the
+    //! `std::vector`s inside `x` may allocate, when they must grow to hold
+    //! the elements that are read.
+    struct deserialize_t {
+        template <typename T>
+        char const* operator()(T& x, char const* first, char const* last) const;
+    };
+
+    constexpr deserialize_t deserialize{};
+
+    //! @ingroup group-experimental
+    //! Returns the number of bytes written by `serialize` for an object.
+    //!
+    //! For objects whose representation does not depend on their value
+    //! (i.e. that contain no `std::vector`), this is the same as
+    //! `max_serialized_size<T>` and it can be used in a constant expression.
+    struct serialized_size_t {
+        template <typename T>
+        constexpr std::size_t operator()(T const& x) const;
+    };
+
+    constexpr serialized_size_t serialized_size{};
+
+    namespace serialize_detail {
+        template <std::size_t N>
+        constexpr std::size_t sum(std::size_t const (&sizes)[N]) {
+            std::size_t total = 0;
+            for (std::size_t i = 0; i != N; ++i)
+                total += sizes[i];
+            return total;
+        }
+
+        // copy:
+        //  `std::memcpy`, except that short copies are done in chunks of 16
+        //  bytes. When the size is known at compile-time, compilers expand
+        //  these chunks inline, whereas they may not do it (or do it poorly)
+        //  for a single `std::memcpy` of the whole size.
+        inline void copy(char* out, char const* in, std::size_t n) {
+            if (n > 64)
+                return (void)std::memcpy(out, in, n);
+            for (; n >= 16; n -= 16, in += 16, out += 16)
+                std::memcpy(out, in, 16);
+            std::memcpy(out, in, n);
+        }
+
+        // writer, reader:
+        //  Copy bytes between the object and the buffer. Instead of copying
+        //  the bytes right away, they keep track of a run of bytes that are
+        //  contiguous in the object, and only copy it when the next bytes are
+        //  not contiguous with it. Since the addresses of the members of an
+        //  object are known at compile time relative to the object, the runs
+        //  are resolved by the compiler and the members of a `struct` without
+        //  padding are copied with a single `std::memcpy`.
+        struct writer {
+            char* out;
+            char const* run;
+            std::size_t run_size;
+
+            void bytes(void const* p, std::size_t n) {
+                char const* bytes = static_cast<char const*>(p);
+                if (bytes != run + run_size) {
+                    flush();
+                    run = bytes;
+                }
+                run_size += n;
+            }
+
+            void length(std::uint64_t n) {
+                flush();
+                std::memcpy(out, &n, sizeof n);
+                out += sizeof n;
+            }
+
+            void flush() {
+                if (run_size != 0) {
+                    serialize_detail::copy(out, run, run_size);
+                    out += run_size;
+                    run_size = 0;
+                }
+            }
+        };
+
+        // When `Checked` is false, the buffer is known to be large enough
+        // and it is never checked. Otherwise, a failed read sets `in` to
+        // `nullptr` and makes all the following reads fail.
+        template <bool Checked>
+        struct reader {
+            char const* in;
+            char const* last;
+            char* run;
+            std::size_t run_size;
+
+            std::size_t remaining() const
+            { return static_cast<std::size_t>(last - in); }
+
+            void fail() {
+                in = last = nullptr;
+                run_size = 0;
+            }
+
+            void bytes(void* p, std::size_t n) {
+                char* bytes = static_cast<char*>(p);
+                if (bytes != run + run_size) {
+                    flush();
+                    run = bytes;
+                }
+                run_size += n;
+            }
+
+            bool length(std::uint64_t& n) {
+                flush();
+                if (Checked && remaining() < sizeof n) {
+                    fail();
+                    return false;
+                }
+                std::memcpy(&n, in, sizeof n);
+                in += sizeof n;
+                return true;
+            }
+
+            void flush() {
+                if (run_size != 0) {
+                    if (Checked && remaining() < run_size)
+                        return fail();
+                    serialize_detail::copy(run, in, run_size);
+                    in += run_size;
+                    run_size = 0;
+                }
+            }
+        };
+
+        // codec:
+        //  Defines the representation of objects of type `T`. `fixed` tells
+        //  whether the size of the representation is always the same, in
+        //  which case it is `size`. Otherwise, `size` is the minimum size
+        //  of the representation. `raw` tells whether the representation is
+        //  the object representation of `T`.
+        template <typename T, typename = void>
+        struct codec : codec<T, hana::when<true>> { };
+
+        template <typename T, bool condition>
+        struct codec<T, hana::when<condition>> {
+            static_assert(condition,
+            "hana::experimental::serialize requires its argument to be made of "
+            "arithmetic types, enumerations, Structs, Sequences, std::arrays "
+            "and std::vectors");
+        };
+
+        template <typename T>
+        struct codec<T, hana::when<std::is_arithmetic<T>::value ||
+                                   std::is_enum<T>::value>> {
+            static constexpr bool fixed = true;
+            static constexpr bool raw = true;
+            static constexpr std::size_t size = sizeof(T);
+
+            static void encode(writer& w, T const& x)
+            { w.bytes(&x, sizeof(T)); }
+
+            template <typename Reader>
+            static void decode(Reader& r, T& x)
+            { r.bytes(&x, sizeof(T)); }
+
+            static constexpr std::size_t encoded_size(T const&)
+            { return sizeof(T); }
+        };
+
+        template <typename T, std::size_t N>
+        struct codec<std::array<T, N>> {
+            using Element = codec<T>;
+            static constexpr bool fixed = Element::fixed;
+            static constexpr bool raw =
+                Element::raw && sizeof(std::array<T, N>) == N * sizeof(T);
+            static constexpr std::size_t size = N * Element::size;
+
+            static void encode(writer& w, std::array<T, N> const& xs)
+            { encode_elements(w, xs, std::integral_constant<bool, raw>{}); }
+
+            static void encode_elements(writer& w, std::array<T, N> const& xs, std::true_type)
+            { w.bytes(xs.data(), N * sizeof(T)); }
+
+            static void encode_elements(writer& w, std::array<T, N> const& xs, std::false_type) {
+                for (T const& x : xs)
+                    Element::encode(w, x);
+            }
+
+            template <typename Reader>
+            static void decode(Reader& r, std::array<T, N>& xs)
+            { decode_elements(r, xs, std::integral_constant<bool, raw>{}); }
+
+            template <typename Reader>
+            static void decode_elements(Reader& r, std::array<T, N>& xs, std::true_type)
+            { r.bytes(xs.data(), N * sizeof(T)); }
+
+            template <typename Reader>
+            static void decode_elements(Reader& r, std::array<T, N>& xs, std::false_type) {
+                for (T& x : xs)
+                    Element::decode(r, x);
+            }
+
+            static std::size_t encoded_size(std::array<T, N> const& xs) {
+                if (Element::fixed)
+                    return size;
+                std::size_t total = 0;
+                for (T const& x : xs)
+                    total += Element::encoded_size(x);
+                return total;
+            }
+        };
+
+        template <typename T, typename Allocator>
+        struct codec<std::vector<T, Allocator>> {
+            using Element = codec<T>;
+            static constexpr bool fixed = false;
+            static constexpr bool raw = false;
+            static constexpr std::size_t size = sizeof(std::uint64_t);
+
+            static void encode(writer& w, std::vector<T, Allocator> const& xs) {
+                w.length(xs.size());
+                encode_elements(w, xs, std::integral_constant<bool, Element::raw>{});
+            }
+
+            static void encode_elements(writer& w, std::vector<T, Allocator> const& xs, std::true_type)
+            { w.bytes(xs.data(), xs.size() * sizeof(T)); }
+
+            static void encode_elements(writer& w, std::vector<T, Allocator> const& xs, std::false_type) {
+                for (T const& x : xs)
+                    Element::encode(w, x);
+            }
+
+            // Since we resize the vector before reading its elements, we make
+            // sure the buffer is large enough to hold them, so that a corrupt
+            // length can't make us allocate an arbitrary amount of memory.
+            template <typename Reader>
+            static void decode(Reader& r, std::vector<T, Allocator>& xs) {
+                std::uint64_t n;
+                if (!r.length(n))
+                    return;
+                if (Element::size != 0 && n > r.remaining() / Element::size)
+                    return r.fail();
+                xs.resize(static_cast<std::size_t>(n));
+                decode_elements(r, xs, std::integral_constant<bool, Element::raw>{});
+            }
+
+            template <typename Reader>
+            static void decode_elements(Reader& r, std::vector<T, Allocator>& xs, std::true_type)
+            { r.bytes(xs.data(), xs.size() * sizeof(T)); }
+
+            template <typename Reader>
+            static void decode_elements(Reader& r, std::vector<T, Allocator>& xs, std::false_type) {
+                for (T& x : xs)
+                    Element::decode(r, x);
+            }
+
+            static std::size_t encoded_size(std::vector<T, Allocator> const& xs) {
+                if (Element::fixed)
+                    return size + xs.size() * Element::size;
+                std::size_t total = size;
+                for (T const& x : xs)
+                    total += Element::encoded_size(x);
+                return total;
+            }
+        };
+
+        // std::vector<bool> packs its elements into bits, so they can't be
+        // accessed through a `bool&`. They are copied through a local `bool`
+        // one at a time, which gives the same representation as for the
+        // other vectors. The run is flushed after each element, since the
+        // local doesn't outlive the iteration.
+        template <typename Allocator>
+        struct codec<std::vector<bool, Allocator>> {
+            using Element = codec<bool>;
+            static constexpr bool fixed = false;
+            static constexpr bool raw = false;
+            static constexpr std::size_t size = sizeof(std::uint64_t);
+
+            static void encode(writer& w, std::vector<bool, Allocator> const& xs) {
+                w.length(xs.size());
+                for (bool x : xs) {
+                    Element::encode(w, x);
+                    w.flush();
+                }
+            }
+
+            template <typename Reader>
+            static void decode(Reader& r, std::vector<bool, Allocator>& xs) {
+                std::uint64_t n;
+                if (!r.length(n))
+                    return;
+                if (n > r.remaining() / Element::size)
+                    return r.fail();
+                xs.resize(static_cast<std::size_t>(n));
+                for (std::size_t i = 0; i != xs.size(); ++i) {
+                    bool x = false;
+                    Element::decode(r, x);
+                    r.flush();
+                    xs[i] = x;
+                }
+            }
+
+            static std::size_t encoded_size(std::vector<bool, Allocator> const& xs)
+            { return size + xs.size() * Element::size; }
+        };
+
+        // fields:
+        //  Codec for the objects that are represented as a sequence of
+        //  fields, which are passed to its functions as a parameter pack.
+        //  `Field...` are the types of the fields as returned by the object,
+        //  which are references unless the object returns them by value.
+        template <typename ...Field>
+        struct fields {
+            static constexpr bool fixed =
+                detail::fast_and<codec<typename detail::decay<Field>::type>::fixed...>::value;
+            static constexpr bool raw = false;
+            static constexpr std::size_t size = serialize_detail::sum({
+                std::size_t{0}, codec<typename detail::decay<Field>::type>::size...
+            });
+            static constexpr bool by_reference =
+                detail::fast_and<std::is_lvalue_reference<Field>::value...>::value;
+
+            struct encode_fields {
+                writer& w;
+
+                template <typename ...F>
+                void operator()(F const& ...f) const {
+                    using swallow = int[];
+                    (void)swallow{0, (codec<F>::encode(w, f), 0)...};
+                    // The fields returned by value are only alive until the
+                    // end of this call, so we must be done copying them.
+                    if (!by_reference)
+                        w.flush();
+                }
+            };
+
+            template <typename Reader>
+            struct decode_fields {
+                Reader& r;
+
+                template <typename ...F>
+                void operator()(F& ...f) const {
+                    using swallow = int[];
+                    (void)swallow{0, (codec<F>::decode(r, f), 0)...};
+                }
+            };
+
+            struct encoded_size_fields {
+                template <typename ...F>
+                std::size_t operator()(F const& ...f) const {
+                    std::size_t total = 0;
+                    using swallow = int[];
+                    (void)swallow{0, (total += codec<F>::encoded_size(f), 0)...};
+                    return total;
+                }
+            };
+        };
+
+        struct collect_fields {
+            template <typename ...F>
+            auto operator()(F&& ...) const -> fields<F...>;
+        };
+
+        template <typename X, typename F>
+        struct with_members {
+            X& x;
+            F const& f;
+
+            template <typename ...Accessor>
+            decltype(auto) operator()(Accessor&& ...accessor) const
+            { return f(hana::second(accessor)(x)...); }
+        };
+
+        template <typename S>
+        struct struct_codec {
+            template <typename X, typename F>
+            static decltype(auto) members(X& x, F const& f) {
+                return hana::unpack(
+                    hana::accessors<typename hana::tag_of<S>::type>(),
+                    with_members<X, F>{x, f}
+                );
+            }
+
+            using Fields = decltype(struct_codec::members(
+                std::declval<S&>(), collect_fields{}
+            ));
+        };
+
+        template <typename S>
+        struct codec<S, hana::when<hana::Struct<S>::value>>
+            : struct_codec<S>::Fields
+        {
+            using Base = struct_codec<S>;
+            using Fields = typename Base::Fields;
+
+            static void encode(writer& w, S const& x)
+            { Base::members(x, typename Fields::encode_fields{w}); }
+
+            template <typename Reader>
+            static void decode(Reader& r, S& x) {
+                static_assert(Fields::by_reference,
+                "hana::experimental::deserialize requires the accessors of a "
+                "Struct to return references to its members");
+                Base::members(x, typename Fields::template decode_fields<Reader>{r});
+            }
+
+            static std::size_t encoded_size(S const& x)
+            { return Base::members(x, typename Fields::encoded_size_fields{}); }
+        };
+
+        template <typename S>
+        struct codec<S, hana::when<hana::Sequence<S>::value &&
+                                   !hana::Struct<S>::value>>
+            : decltype(hana::unpack(std::declval<S&>(), collect_fields{}))
+        {
+            using Fields = decltype(hana::unpack(std::declval<S&>(), collect_fields{}));
+
+            static void encode(writer& w, S const& xs)
+            { hana::unpack(xs, typename Fields::encode_fields{w}); }
+
+            template <typename Reader>
+            static void decode(Reader& r, S& xs)
+            { hana::unpack(xs, typename Fields::template decode_fields<Reader>{r}); }
+
+            static std::size_t encoded_size(S const& xs)
+            { return hana::unpack(xs, typename Fields::encoded_size_fields{}); }
+        };
+
+        template <typename T>
+        struct max_size {
+            static_assert(codec<T>::fixed,
+            "hana::experimental::max_serialized_size<T> requires the size of "
+            "the representation of T not to depend on its value, which is not "
+            "the case when T contains a std::vector");
+            static constexpr std::size_t value = codec<T>::size;
+        };
+
+        template <typename T>
+        constexpr std::size_t serialized_size_impl(T const&, std::true_type)
+        { return codec<T>::size; }
+
+        template <typename T>
+        std::size_t serialized_size_impl(T const& x, std::false_type)
+        { return codec<T>::encoded_size(x); }
+
+        template <typename T>
+        char const* deserialize_impl(T& x, char const* first, char const* last, std::true_type) {
+            if (static_cast<std::size_t>(last - first) < codec<T>::size)
+                return nullptr;
+            reader<false> r{first, last, nullptr, 0};
+            codec<T>::decode(r, x);
+            r.flush();
+            return r.in;
+        }
+
+        template <typename T>
+        char const* deserialize_impl(T& x, char const* first, char const* last, std::false_type) {
+            reader<true> r{first, last, nullptr, 0};
+            codec<T>::decode(r, x);
+            r.flush();
+            return r.in;
+        }
+    }
+
+    //! @ingroup group-experimental
+    //! The maximum number of bytes written by `serialize` for an object of
+    //! type `T`, which must not contain any `std::vector`.
+    //!
+    //! This can be used to create a buffer that is large enough for any
+    //! object of type `T`:
+    //! @code
+    //!     char buffer[hana::experimental::max_serialized_size<T>];
+    //! @endcode
+    template <typename T>
+    constexpr std::size_t max_serialized_size = serialize_detail::max_size<T>::value;
+
+    //! @cond
+    template <typename T>
+    char* serialize_t::operator()(T const& x, char* first, char* last) const {
+        if (static_cast<std::size_t>(last - first) < hana::experimental::serialized_size(x))
+            return nullptr;
+        serialize_detail::writer w{first, nullptr, 0};
+        serialize_detail::codec<T>::encode(w, x);
+        w.flush();
+        return w.out;
+    }
+
+    template <typename T>
+    char const* deserialize_t::operator()(T& x, char const* first, char const* last) const {
+        return serialize_detail::deserialize_impl(x, first, last,
+            std::integral_constant<bool, serialize_detail::codec<T>::fixed>{});
+    }
+
+    template <typename T>
+    constexpr std::size_t serialized_size_t::operator()(T const& x) const {
+        return serialize_detail::serialized_size_impl(x,
+            std::integral_constant<bool, serialize_detail::codec<T>::fixed>{});
+    }
+    //! @endcond
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_SERIALIZE_HPP
@@ -14,13 +14,33 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/metafunction.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/any_of.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
+#include <boost/hana/detail/index_if.hpp>
+#include <boost/hana/detail/merge_sort.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/detail/type_foldl1.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/fwd/at.hpp>
+#include <boost/hana/fwd/concat.hpp>
 #include <boost/hana/fwd/contains.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/filter.hpp>
+#include <boost/hana/fwd/find_if.hpp>
+#include <boost/hana/fwd/flatten.hpp>
+#include <boost/hana/fwd/fold_left.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
+#include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/remove_if.hpp>
+#include <boost/hana/fwd/reverse.hpp>
+#include <boost/hana/fwd/sort.hpp>
 #include <boost/hana/fwd/transform.hpp>
+#include <boost/hana/fwd/unique.hpp>
 #include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/fwd/zip.hpp>
+#include <boost/hana/optional.hpp>
 #include <boost/hana/type.hpp>
 
 #include <cstddef>
@@ -38,6 +58,11 @@ BOOST_HANA_NAMESPACE_BEGIN
         //! storing and manipulating pure types in a much more compile-time
         //! efficient manner than using `hana::tuple`, which must assume that
         //! its contents might have runtime values.
+        //!
+        //! The algorithms implemented for `types` never create `hana::type`
+        //! objects or any other runtime value; predicates and functions are
+        //! only ever called in unevaluated contexts. When a function is a
+        //! `Metafunction`, it is applied to the types directly.
         template <typename ...T>
         struct types;
 
@@ -54,6 +79,105 @@ BOOST_HANA_NAMESPACE_BEGIN
         using type = experimental::types_tag;
     };
 
+    namespace types_detail {
+        // predicate:
+        //  Compile-time boolean result of calling `Pred` on some types. A
+        //  `Metafunction` is applied to the types directly, and any other
+        //  function object is called with `hana::type`s in an unevaluated
+        //  context. In both cases, the result must be a compile-time
+        //  `Logical`.
+        template <typename Pred, bool = hana::Metafunction<Pred>::value>
+        struct predicate {
+            template <typename ...T>
+            using apply = hana::bool_<static_cast<bool>(
+                Pred::template apply<T...>::type::value
+            )>;
+        };
+
+        template <typename Pred>
+        struct predicate<Pred, false> {
+            template <typename ...T>
+            using apply = hana::bool_<static_cast<bool>(detail::decay<decltype(
+                std::declval<Pred const&>()(hana::type<T>{}...)
+            )>::type::value)>;
+        };
+
+        struct same {
+            template <typename T, typename U>
+            using apply = std::is_same<T, U>;
+        };
+
+        // select:
+        //  Returns the `types` made of the types at the given indices in a
+        //  `type_pack`. `select_indices` does the same with the indices of
+        //  a `detail::filter_indices`.
+        template <typename Pack, std::size_t ...i>
+        constexpr hana::experimental::types<typename Pack::template at<i>...>
+        select(std::index_sequence<i...>) { return {}; }
+
+        template <typename Pack, typename Indices, std::size_t ...i>
+        constexpr auto select_indices(std::index_sequence<i...>) {
+            return types_detail::select<Pack>(
+                std::index_sequence<Indices::indices[i]...>{}
+            );
+        }
+
+        template <typename Pack, typename Indices>
+        constexpr auto select_indices() {
+            return types_detail::select_indices<Pack, Indices>(
+                std::make_index_sequence<Indices::indices.size()>{}
+            );
+        }
+
+        template <typename Types>
+        struct to_pack;
+
+        template <typename ...T>
+        struct to_pack<hana::experimental::types<T...>> {
+            using type = detail::type_pack<T...>;
+            static constexpr std::size_t size = sizeof...(T);
+        };
+
+        // join:
+        //  Concatenates any number of `types`, four at a time.
+        template <typename ...Types>
+        struct join;
+
+        template <>
+        struct join<> {
+            using type = hana::experimental::types<>;
+        };
+
+        template <typename ...T>
+        struct join<hana::experimental::types<T...>> {
+            using type = hana::experimental::types<T...>;
+        };
+
+        template <typename ...T1, typename ...T2>
+        struct join<hana::experimental::types<T1...>,
+                    hana::experimental::types<T2...>>
+        {
+            using type = hana::experimental::types<T1..., T2...>;
+        };
+
+        template <typename ...T1, typename ...T2, typename ...T3>
+        struct join<hana::experimental::types<T1...>,
+                    hana::experimental::types<T2...>,
+                    hana::experimental::types<T3...>>
+        {
+            using type = hana::experimental::types<T1..., T2..., T3...>;
+        };
+
+        template <typename ...T1, typename ...T2, typename ...T3,
+                  typename ...T4, typename ...Rest>
+        struct join<hana::experimental::types<T1...>,
+                    hana::experimental::types<T2...>,
+                    hana::experimental::types<T3...>,
+                    hana::experimental::types<T4...>, Rest...>
+            : join<hana::experimental::types<T1..., T2..., T3..., T4...>, Rest...>
+        { };
+    }
+
     // Foldable
     template <>
     struct unpack_impl<hana::experimental::types_tag> {
@@ -71,6 +195,62 @@ BOOST_HANA_NAMESPACE_BEGIN
         apply(hana::experimental::types<T...> const&, F const&) { return {}; }
     };
 
+    template <>
+    struct fold_left_impl<hana::experimental::types_tag> {
+        // A `Metafunction` is folded at the type level, but only when the
+        // state is itself a `hana::type`.
+        template <typename F, typename S>
+        using type_level = std::integral_constant<bool,
+            hana::Metafunction<F>::value &&
+            std::is_same<typename hana::tag_of<S>::type, hana::type_tag>::value
+        >;
+
+        // with state
+        template <typename ...T, typename S, typename F, typename = typename std::enable_if<
+            !type_level<F, S>::value
+        >::type>
+        static constexpr decltype(auto)
+        apply(hana::experimental::types<T...> const&, S&& s, F&& f) {
+            return detail::variadic::foldl1(static_cast<F&&>(f),
+                                            static_cast<S&&>(s),
+                                            hana::type<T>{}...);
+        }
+
+        template <typename ...T, typename S, typename F, typename = typename std::enable_if<
+            type_level<F, S>::value
+        >::type>
+        static constexpr hana::type<
+            typename detail::type_foldl1<F::template apply, typename S::type, T...>::type
+        > apply(hana::experimental::types<T...> const&, S const&, F const&)
+        { return {}; }
+
+        // without state
+        template <typename ...T, typename F, typename = typename std::enable_if<
+            !hana::Metafunction<F>::value
+        >::type>
+        static constexpr decltype(auto)
+        apply(hana::experimental::types<T...> const&, F&& f) {
+            return detail::variadic::foldl1(static_cast<F&&>(f),
+                                            hana::type<T>{}...);
+        }
+
+        template <typename ...T, typename F, typename = typename std::enable_if<
+            hana::Metafunction<F>::value
+        >::type>
+        static constexpr hana::type<
+            typename detail::type_foldl1<F::template apply, T...>::type
+        > apply(hana::experimental::types<T...> const&, F const&)
+        { return {}; }
+    };
+
+    template <>
+    struct length_impl<hana::experimental::types_tag> {
+        template <typename ...T>
+        static constexpr hana::size_t<sizeof...(T)>
+        apply(hana::experimental::types<T...> const&)
+        { return {}; }
+    };
+
     // Functor
     template <>
     struct transform_impl<hana::experimental::types_tag> {
@@ -88,31 +268,13 @@ BOOST_HANA_NAMESPACE_BEGIN
         apply(hana::experimental::types<T...> const&, F const&) { return {}; }
     };
 
-    namespace types_detail {
-        template <std::size_t I, typename T>
-        struct elt { using type = T; };
-
-        template <typename Indices, typename ...T>
-        struct indexer;
-
-        template <std::size_t ...I, typename ...T>
-        struct indexer<std::index_sequence<I...>, T...>
-            : elt<I, T>...
-        { };
-
-        template <std::size_t I, typename T>
-        elt<I, T> get_elt(elt<I, T> const&);
-    }
-
     // Iterable
     template <>
     struct at_impl<hana::experimental::types_tag> {
         template <typename ...T, typename N>
         static constexpr auto
         apply(hana::experimental::types<T...> const&, N const&) {
-            using Indexer = types_detail::indexer<std::make_index_sequence<sizeof...(T)>, T...>;
-            using Nth = typename decltype(types_detail::get_elt<N::value>(Indexer{}))::type;
-            return hana::type<Nth>{};
+            return hana::type<detail::type_at<N::value, T...>>{};
         }
     };
 
@@ -126,9 +288,9 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <>
     struct drop_front_impl<hana::experimental::types_tag> {
-        template <std::size_t n, typename Indexer, std::size_t ...i>
+        template <std::size_t n, typename Pack, std::size_t ...i>
         static hana::experimental::types<
-            typename decltype(types_detail::get_elt<i + n>(Indexer{}))::type...
+            typename Pack::template at<i + n>...
         > helper(std::index_sequence<i...>);
 
         template <typename ...T, typename N>
@@ -136,8 +298,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         apply(hana::experimental::types<T...> const&, N const&) {
             constexpr std::size_t n = N::value > sizeof...(T) ? sizeof...(T) : N::value;
             using Indices = std::make_index_sequence<sizeof...(T) - n>;
-            using Indexer = types_detail::indexer<std::make_index_sequence<sizeof...(T)>, T...>;
-            return decltype(helper<n, Indexer>(Indices{})){};
+            return decltype(helper<n, detail::type_pack<T...>>(Indices{})){};
         }
     };
 
@@ -162,6 +323,27 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr hana::false_ apply(...) { return {}; }
     };
 
+    template <>
+    struct find_if_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            constexpr std::size_t index = detail::index_if<
+                Pred const&, detail::pack<hana::type<T>...>
+            >::value;
+            return helper<index, T...>(hana::bool_c<(index < sizeof...(T))>);
+        }
+
+        template <std::size_t index, typename ...T>
+        static constexpr auto helper(hana::true_) {
+            return hana::just(hana::type<detail::type_at<index, T...>>{});
+        }
+
+        template <std::size_t index, typename ...T>
+        static constexpr auto helper(hana::false_)
+        { return hana::nothing; }
+    };
+
     // Comparable
     template <>
     struct equal_impl<hana::experimental::types_tag, hana::experimental::types_tag> {
@@ -173,6 +355,141 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr hana::false_ apply(Ts const&, Us const&)
         { return {}; }
     };
+
+    // MonadPlus
+    template <>
+    struct concat_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename ...U>
+        static constexpr hana::experimental::types<T..., U...>
+        apply(hana::experimental::types<T...> const&,
+              hana::experimental::types<U...> const&)
+        { return {}; }
+    };
+
+    template <>
+    struct filter_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Keep = types_detail::predicate<Pred>;
+            using Indices = detail::filter_indices<Keep::template apply<T>::value...>;
+            return types_detail::select_indices<detail::type_pack<T...>, Indices>();
+        }
+    };
+
+    template <>
+    struct remove_if_impl<hana::experimental::types_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Remove = types_detail::predicate<Pred>;
+            using Indices = detail::filter_indices<!Remove::template apply<T>::value...>;
+            return types_detail::select_indices<detail::type_pack<T...>, Indices>();
+        }
+    };
+
+    // Monad
+    template <>
+    struct flatten_impl<hana::experimental::types_tag> {
+        template <typename ...Types>
+        static constexpr typename types_detail::join<Types...>::type
+        apply(hana::experimental::types<Types...> const&)
+        { return {}; }
+    };
+
+    // Sequence
+    template <>
+    struct reverse_impl<hana::experimental::types_tag> {
+        template <typename Pack, std::size_t ...i>
+        static constexpr hana::experimental::types<
+            typename Pack::template at<sizeof...(i) - i - 1>...
+        > helper(std::index_sequence<i...>) { return {}; }
+
+        template <typename ...T>
+        static constexpr auto apply(hana::experimental::types<T...> const&) {
+            return helper<detail::type_pack<T...>>(
+                std::make_index_sequence<sizeof...(T)>{}
+            );
+        }
+    };
+
+    template <>
+    struct sort_impl<hana::experimental::types_tag> {
+        template <typename Pack, typename Less>
+        struct sort_predicate {
+            template <std::size_t i, std::size_t j>
+            using apply = typename Less::template apply<
+                typename Pack::template at<i>, typename Pack::template at<j>
+            >;
+        };
+
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Pred const&) {
+            using Pack = detail::type_pack<T...>;
+            using Indices = typename detail::sort_helper<
+                sort_predicate<Pack, types_detail::predicate<Pred>>,
+                std::make_index_sequence<sizeof...(T)>
+            >::type;
+            return types_detail::select<Pack>(Indices{});
+        }
+    };
+
+    template <>
+    struct unique_impl<hana::experimental::types_tag> {
+        template <typename Pack, typename Equal, std::size_t ...i>
+        static constexpr auto helper(std::index_sequence<i...>) {
+            using Indices = detail::filter_indices<true, !Equal::template apply<
+                typename Pack::template at<i>, typename Pack::template at<i + 1>
+            >::value...>;
+            return types_detail::select_indices<Pack, Indices>();
+        }
+
+        template <typename Equal>
+        static constexpr hana::experimental::types<>
+        apply_impl(hana::experimental::types<> const&)
+        { return {}; }
+
+        template <typename Equal, typename T, typename ...Ts>
+        static constexpr auto
+        apply_impl(hana::experimental::types<T, Ts...> const&) {
+            return helper<detail::type_pack<T, Ts...>, Equal>(
+                std::make_index_sequence<sizeof...(Ts)>{}
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs const& xs, Pred const&)
+        { return apply_impl<types_detail::predicate<Pred>>(xs); }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return apply_impl<types_detail::same>(xs); }
+    };
+
+    template <>
+    struct zip_impl<hana::experimental::types_tag> {
+        template <std::size_t i, typename ...Packs>
+        using zipped = hana::experimental::types<typename Packs::template at<i>...>;
+
+        template <typename ...Packs, std::size_t ...i>
+        static constexpr hana::experimental::types<zipped<i, Packs...>...>
+        helper(std::index_sequence<i...>) { return {}; }
+
+        template <typename ...T, typename ...Types>
+        static constexpr auto
+        apply(hana::experimental::types<T...> const&, Types const& ...) {
+            static_assert(detail::fast_and<
+                types_detail::to_pack<Types>::size == sizeof...(T)...
+            >::value,
+            "hana::zip(xs, ys...) requires all the sequences to have the same length");
+
+            return helper<detail::type_pack<T...>,
+                          typename types_detail::to_pack<Types>::type...>(
+                std::make_index_sequence<sizeof...(T)>{}
+            );
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_EXPERIMENTAL_TYPES_HPP
@@ -13,7 +13,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/and.hpp>
 #include <boost/hana/at.hpp>
 #include <boost/hana/bool.hpp>
+#include <boost/hana/cartesian_product.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
+#include <boost/hana/find_if.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/fwd/ap.hpp>
@@ -29,7 +33,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/length.hpp>
 #include <boost/hana/lexicographical_compare.hpp>
-#include <boost/hana/range.hpp>
+#include <boost/hana/permutations.hpp>
+#include <boost/hana/remove_at.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/take_front.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/unpack.hpp>
 
@@ -70,6 +78,20 @@ namespace experimental {
         using view_storage = typename std::conditional<
             detail::is_view<Sequence>::value, Sequence, Sequence&
         >::type;
+
+        // Views are held by value inside other views, but other sequences
+        // are held by reference. Hence, a view can be created from a
+        // temporary view (which allows chaining views), but not from a
+        // temporary sequence, which would leave us with a dangling reference.
+        template <typename Sequence>
+        struct view_sequence {
+            using type = typename std::remove_reference<Sequence>::type;
+
+            static_assert(std::is_lvalue_reference<Sequence>::value ||
+                          detail::is_view<type>::value,
+            "hana::experimental views can only be created from lvalue "
+            "sequences or from other views");
+        };
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -82,9 +104,12 @@ namespace experimental {
     };
 
     template <typename Sequence, typename Indices>
-    constexpr auto sliced(Sequence& sequence, Indices const& indices) {
+    constexpr auto sliced(Sequence&& sequence, Indices const& indices) {
+        using S = typename detail::view_sequence<Sequence>::type;
         return hana::unpack(indices, [&](auto ...i) {
-            return sliced_view_t<Sequence, decltype(i)::value...>{sequence};
+            return sliced_view_t<S, decltype(i)::value...>{
+                static_cast<Sequence&&>(sequence)
+            };
         });
     }
 
@@ -106,9 +131,12 @@ namespace experimental {
     };
 
     template <typename Sequence, typename F>
-    constexpr transformed_view_t<Sequence, typename hana::detail::decay<F>::type>
-    transformed(Sequence& sequence, F&& f) {
-        return {sequence, static_cast<F&&>(f)};
+    constexpr transformed_view_t<
+        typename detail::view_sequence<Sequence>::type,
+        typename hana::detail::decay<F>::type
+    >
+    transformed(Sequence&& sequence, F&& f) {
+        return {static_cast<Sequence&&>(sequence), static_cast<F&&>(f)};
     }
 
     namespace detail {
@@ -121,15 +149,74 @@ namespace experimental {
     //////////////////////////////////////////////////////////////////////////
     // filtered_view
     //////////////////////////////////////////////////////////////////////////
-#if 0
+    namespace detail {
+        template <typename Sequence, typename Indices,
+                  typename = std::make_index_sequence<Indices::indices.size()>>
+        struct filtered_view;
+
+        template <typename Sequence, typename Indices, std::size_t ...i>
+        struct filtered_view<Sequence, Indices, std::index_sequence<i...>> {
+            using type = sliced_view_t<Sequence, Indices::indices[i]...>;
+        };
+    }
+
+    // A filtered view is just a sliced view whose indices are computed
+    // exactly like in `hana::filter`.
     template <typename Sequence, typename Pred>
-    using filtered_view_t = sliced_view_t<Sequence, detail::filtered_indices<...>>;
+    using filtered_view_t = typename detail::filtered_view<
+        Sequence,
+        decltype(hana::unpack(
+            std::declval<detail::view_storage<Sequence>>(),
+            hana::detail::make_filter_indices<Pred>{std::declval<Pred const&>()}
+        ))
+    >::type;
 
     template <typename Sequence, typename Pred>
-    constexpr filtered_view_t<Sequence, Pred> filtered(Sequence& sequence, Pred&& pred) {
-        return {sequence};
+    constexpr filtered_view_t<
+        typename detail::view_sequence<Sequence>::type,
+        typename hana::detail::decay<Pred>::type
+    >
+    filtered(Sequence&& sequence, Pred&&) {
+        return {static_cast<Sequence&&>(sequence)};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // zipped_view
+    //////////////////////////////////////////////////////////////////////////
+    template <typename ...Sequences>
+    struct zipped_view_t {
+        hana::tuple<detail::view_storage<Sequences>...> sequences_;
+        using hana_tag = view_tag;
+    };
+
+    // The n-th element of a zipped view is a `hana::tuple` holding the n-th
+    // element of each sequence. When these elements are references (e.g.
+    // when zipping sequences that are not views), the tuple holds references
+    // to them, so no element is ever copied.
+    struct make_zipped_view_t {
+        template <typename Sequence1, typename ...Sequences>
+        constexpr zipped_view_t<
+            typename detail::view_sequence<Sequence1>::type,
+            typename detail::view_sequence<Sequences>::type...
+        >
+        operator()(Sequence1&& s1, Sequences&& ...sn) const {
+            static_assert(hana::detail::fast_and<
+                (decltype(hana::length(sn))::value ==
+                 decltype(hana::length(s1))::value)...
+            >::value,
+            "hana::experimental::zipped(sequences...) requires all the "
+            "sequences to have the same length");
+            return {{static_cast<Sequence1&&>(s1), static_cast<Sequences&&>(sn)...}};
+        }
+    };
+    constexpr make_zipped_view_t zipped{};
+
+    namespace detail {
+        template <typename ...Sequences>
+        struct is_view<zipped_view_t<Sequences...>> {
+            static constexpr bool value = true;
+        };
     }
-#endif
 
     //////////////////////////////////////////////////////////////////////////
     // joined_view
@@ -143,8 +230,12 @@ namespace experimental {
 
     struct make_joined_view_t {
         template <typename Sequence1, typename Sequence2>
-        constexpr joined_view_t<Sequence1, Sequence2> operator()(Sequence1& s1, Sequence2& s2) const {
-            return {s1, s2};
+        constexpr joined_view_t<
+            typename detail::view_sequence<Sequence1>::type,
+            typename detail::view_sequence<Sequence2>::type
+        >
+        operator()(Sequence1&& s1, Sequence2&& s2) const {
+            return {static_cast<Sequence1&&>(s1), static_cast<Sequence2&&>(s2)};
         }
     };
     constexpr make_joined_view_t joined{};
@@ -156,6 +247,73 @@ namespace experimental {
         };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // cartesian_product_view
+    //////////////////////////////////////////////////////////////////////////
+    template <typename ...Sequences>
+    struct cartesian_product_view_t {
+        hana::tuple<detail::view_storage<Sequences>...> sequences_;
+        using hana_tag = view_tag;
+    };
+
+    // Lazy counterpart of `hana::cartesian_product(make_tuple(sequences...))`.
+    // The k-th element is only computed when it is accessed; it is a
+    // `hana::tuple` holding the corresponding element of each sequence
+    // (by reference whenever the sequence returns a reference).
+    struct make_cartesian_product_view_t {
+        template <typename Sequence1, typename ...Sequences>
+        constexpr cartesian_product_view_t<
+            typename detail::view_sequence<Sequence1>::type,
+            typename detail::view_sequence<Sequences>::type...
+        >
+        operator()(Sequence1&& s1, Sequences&& ...sn) const {
+            return {{static_cast<Sequence1&&>(s1), static_cast<Sequences&&>(sn)...}};
+        }
+    };
+    constexpr make_cartesian_product_view_t cartesian_product_view{};
+
+    namespace detail {
+        template <typename ...Sequences>
+        struct is_view<cartesian_product_view_t<Sequences...>> {
+            static constexpr bool value = true;
+        };
+
+        template <typename ...Sequences>
+        using product_indices = hana::detail::cartesian_product_indices<
+            decltype(hana::length(std::declval<view_storage<Sequences>>()))::value...
+        >;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // permutations_view
+    //////////////////////////////////////////////////////////////////////////
+    template <typename Sequence>
+    struct permutations_view_t {
+        detail::view_storage<Sequence> sequence_;
+        using hana_tag = view_tag;
+    };
+
+    // Lazy counterpart of `hana::permutations(sequence)`. The k-th element
+    // is a sliced view of the sequence, whose indices are decoded from `k`
+    // when it is accessed.
+    template <typename Sequence>
+    constexpr permutations_view_t<typename detail::view_sequence<Sequence>::type>
+    permutations_view(Sequence&& sequence) {
+        return {static_cast<Sequence&&>(sequence)};
+    }
+
+    namespace detail {
+        template <typename Sequence>
+        struct is_view<permutations_view_t<Sequence>> {
+            static constexpr bool value = true;
+        };
+
+        template <typename Sequence>
+        using permutations_size = decltype(
+            hana::length(std::declval<view_storage<Sequence>>())
+        );
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // single_view
     //////////////////////////////////////////////////////////////////////////
@@ -196,6 +354,57 @@ namespace experimental {
     }
 } // end namespace experimental
 
+namespace experimental { namespace detail {
+    // Calls `g(f(x)...)` without copying `f` nor `g`. This is used to unpack
+    // a transformed view; since `fold_left` and `for_each` are implemented
+    // with `unpack`, they go straight through a chain of views to the
+    // underlying elements, without creating any intermediate sequence.
+    template <typename F, typename G>
+    struct unpack_transformed {
+        F& f;
+        G& g;
+
+        template <typename ...X>
+        constexpr decltype(auto) operator()(X&& ...x) const {
+            return static_cast<G&&>(g)(f(static_cast<X&&>(x))...);
+        }
+    };
+
+    // Returns the n-th element of a zipped view, i.e. a `hana::tuple` holding
+    // the n-th element of each zipped sequence (by reference whenever the
+    // sequence returns a reference).
+    template <std::size_t n, typename Sequences, std::size_t ...s>
+    constexpr hana::tuple<decltype(hana::at_c<n>(hana::at_c<s>(std::declval<Sequences&>())))...>
+    zipped_at(Sequences& sequences, std::index_sequence<s...>) {
+        (void)sequences; // Remove spurious unused variable warning with GCC
+        return {hana::at_c<n>(hana::at_c<s>(sequences))...};
+    }
+
+    // Returns the n-th element of a cartesian product view, i.e. a
+    // `hana::tuple` holding the element of each sequence whose index is
+    // decoded from `n`.
+    template <std::size_t n, typename Indices, typename Sequences, std::size_t ...s>
+    constexpr hana::tuple<decltype(hana::at_c<Indices::indices_of(n)[s]>(
+        hana::at_c<s>(std::declval<Sequences&>())
+    ))...>
+    product_at(Sequences& sequences, std::index_sequence<s...>) {
+        (void)sequences; // Remove spurious unused variable warning with GCC
+        constexpr auto indices = Indices::indices_of(n);
+        return {hana::at_c<indices[s]>(hana::at_c<s>(sequences))...};
+    }
+
+    // Returns the n-th permutation of the sequence held by a permutations
+    // view, as a sliced view of that sequence.
+    template <std::size_t n, typename Sequence, std::size_t ...i>
+    constexpr auto permutation_at(permutations_view_t<Sequence> view,
+                                  std::index_sequence<i...>)
+    {
+        constexpr auto indices = hana::detail::nth_permutation<sizeof...(i)>(n);
+        (void)indices; // workaround GCC warning when sizeof...(i) == 0
+        return sliced_view_t<Sequence, indices[i]...>{view.sequence_};
+    }
+}} // end namespace experimental::detail
+
 //////////////////////////////////////////////////////////////////////////
 // Foldable
 //////////////////////////////////////////////////////////////////////////
@@ -213,7 +422,29 @@ struct unpack_impl<experimental::view_tag> {
     template <typename Sequence, typename F, typename G>
     static constexpr decltype(auto)
     apply(experimental::transformed_view_t<Sequence, F> view, G&& g) {
-        return hana::unpack(view.sequence_, hana::on(static_cast<G&&>(g), view.f_));
+        return hana::unpack(view.sequence_,
+            experimental::detail::unpack_transformed<F, G>{view.f_, g});
+    }
+
+    // zipped_view
+    template <typename ...S, typename F, std::size_t ...n>
+    static constexpr decltype(auto)
+    unpack_zipped(experimental::zipped_view_t<S...>& view, F&& f,
+                  std::index_sequence<n...>)
+    {
+        (void)view; // Remove spurious unused variable warning with GCC
+        return static_cast<F&&>(f)(
+            experimental::detail::zipped_at<n>(view.sequences_,
+                                    std::index_sequence_for<S...>{})...
+        );
+    }
+
+    template <typename ...S, typename F>
+    static constexpr decltype(auto)
+    apply(experimental::zipped_view_t<S...> view, F&& f) {
+        constexpr auto N = decltype(hana::length(view))::value;
+        return unpack_zipped(view, static_cast<F&&>(f),
+                             std::make_index_sequence<N>{});
     }
 
     // joined_view
@@ -237,6 +468,50 @@ struct unpack_impl<experimental::view_tag> {
                              std::make_index_sequence<N2>{});
     }
 
+    // cartesian_product_view
+    template <typename ...S, typename F, std::size_t ...n>
+    static constexpr decltype(auto)
+    unpack_product(experimental::cartesian_product_view_t<S...>& view, F&& f,
+                   std::index_sequence<n...>)
+    {
+        (void)view; // Remove spurious unused variable warning with GCC
+        using Indices = experimental::detail::product_indices<S...>;
+        return static_cast<F&&>(f)(
+            experimental::detail::product_at<n, Indices>(view.sequences_,
+                                        std::index_sequence_for<S...>{})...
+        );
+    }
+
+    template <typename ...S, typename F>
+    static constexpr decltype(auto)
+    apply(experimental::cartesian_product_view_t<S...> view, F&& f) {
+        constexpr auto N = decltype(hana::length(view))::value;
+        return unpack_product(view, static_cast<F&&>(f),
+                              std::make_index_sequence<N>{});
+    }
+
+    // permutations_view
+    template <typename S, typename F, std::size_t ...n>
+    static constexpr decltype(auto)
+    unpack_permutations(experimental::permutations_view_t<S> view, F&& f,
+                        std::index_sequence<n...>)
+    {
+        (void)view; // Remove spurious unused variable warning with GCC
+        using Size = experimental::detail::permutations_size<S>;
+        return static_cast<F&&>(f)(
+            experimental::detail::permutation_at<n>(view,
+                                        std::make_index_sequence<Size::value>{})...
+        );
+    }
+
+    template <typename S, typename F>
+    static constexpr decltype(auto)
+    apply(experimental::permutations_view_t<S> view, F&& f) {
+        constexpr auto N = decltype(hana::length(view))::value;
+        return unpack_permutations(view, static_cast<F&&>(f),
+                                   std::make_index_sequence<N>{});
+    }
+
     // single_view
     template <typename T, typename F>
     static constexpr decltype(auto) apply(experimental::single_view_t<T> view, F&& f) {
@@ -271,6 +546,14 @@ struct at_impl<experimental::view_tag> {
         return view.f_(hana::at(view.sequence_, n));
     }
 
+    // zipped_view
+    template <typename ...S, typename N>
+    static constexpr auto
+    apply(experimental::zipped_view_t<S...> view, N const&) {
+        return experimental::detail::zipped_at<N::value>(view.sequences_,
+                                        std::index_sequence_for<S...>{});
+    }
+
     // joined_view
     template <std::size_t Left, typename View, typename N>
     static constexpr decltype(auto) at_joined_view(View view, N const&, hana::true_) {
@@ -289,6 +572,28 @@ struct at_impl<experimental::view_tag> {
         return at_joined_view<Left>(view, n, hana::bool_c<(N::value < Left)>);
     }
 
+    // cartesian_product_view
+    template <typename ...S, typename N>
+    static constexpr auto
+    apply(experimental::cartesian_product_view_t<S...> view, N const&) {
+        using Indices = experimental::detail::product_indices<S...>;
+        static_assert(N::value < decltype(hana::length(view))::value,
+        "trying to fetch an out-of-bounds element in a hana::cartesian_product_view");
+        return experimental::detail::product_at<N::value, Indices>(view.sequences_,
+                                        std::index_sequence_for<S...>{});
+    }
+
+    // permutations_view
+    template <typename S, typename N>
+    static constexpr auto
+    apply(experimental::permutations_view_t<S> view, N const&) {
+        using Size = experimental::detail::permutations_size<S>;
+        static_assert(N::value < decltype(hana::length(view))::value,
+        "trying to fetch an out-of-bounds element in a hana::permutations_view");
+        return experimental::detail::permutation_at<N::value>(view,
+                                        std::make_index_sequence<Size::value>{});
+    }
+
     // single_view
     template <typename T, typename N>
     static constexpr decltype(auto) apply(experimental::single_view_t<T> view, N const&) {
@@ -317,6 +622,12 @@ struct length_impl<experimental::view_tag> {
         return hana::length(view.sequence_);
     }
 
+    // zipped_view
+    template <typename ...S>
+    static constexpr auto apply(experimental::zipped_view_t<S...> view) {
+        return hana::length(hana::at_c<0>(view.sequences_));
+    }
+
     // joined_view
     template <typename S1, typename S2>
     static constexpr auto apply(experimental::joined_view_t<S1, S2> view) {
@@ -326,6 +637,19 @@ struct length_impl<experimental::view_tag> {
         >;
     }
 
+    // cartesian_product_view
+    template <typename ...S>
+    static constexpr auto apply(experimental::cartesian_product_view_t<S...> const&) {
+        return hana::size_c<experimental::detail::product_indices<S...>::length>;
+    }
+
+    // permutations_view
+    template <typename S>
+    static constexpr auto apply(experimental::permutations_view_t<S> const&) {
+        using Size = experimental::detail::permutations_size<S>;
+        return hana::size_c<hana::detail::factorial(Size::value)>;
+    }
+
     // single_view
     template <typename T>
     static constexpr auto apply(experimental::single_view_t<T>) {
@@ -353,6 +677,12 @@ struct is_empty_impl<experimental::view_tag> {
         return hana::is_empty(view.sequence_);
     }
 
+    // zipped_view
+    template <typename ...S>
+    static constexpr auto apply(experimental::zipped_view_t<S...> view) {
+        return hana::is_empty(hana::at_c<0>(view.sequences_));
+    }
+
     // joined_view
     template <typename S1, typename S2>
     static constexpr auto apply(experimental::joined_view_t<S1, S2> view) {
@@ -360,6 +690,18 @@ struct is_empty_impl<experimental::view_tag> {
                           hana::is_empty(view.sequence2_));
     }
 
+    // cartesian_product_view
+    template <typename ...S>
+    static constexpr auto apply(experimental::cartesian_product_view_t<S...> const& view) {
+        return hana::bool_c<decltype(hana::length(view))::value == 0>;
+    }
+
+    // permutations_view
+    template <typename S>
+    static constexpr auto apply(experimental::permutations_view_t<S> const&) {
+        return hana::false_c;
+    }
+
     // single_view
     template <typename T>
     static constexpr auto apply(experimental::single_view_t<T>) {
@@ -372,13 +714,119 @@ struct is_empty_impl<experimental::view_tag> {
     }
 };
 
+//////////////////////////////////////////////////////////////////////////
+// Index-only algorithms
+//
+// These algorithms only reorder or select elements, so they return a
+// sliced view of the original view instead of creating a new sequence.
+// No element is ever copied or moved.
+//////////////////////////////////////////////////////////////////////////
+namespace experimental { namespace detail {
+    // reindexed:
+    //  Returns a view of the elements of `view` at the given indices. When
+    //  `view` is itself a sliced view, the indices are composed with its
+    //  own indices so that we do not end up with a chain of sliced views.
+    template <typename View, std::size_t ...j>
+    constexpr sliced_view_t<View, j...>
+    reindexed(View view, std::index_sequence<j...>) {
+        return {view};
+    }
+
+    template <typename Sequence, std::size_t ...i, std::size_t ...j>
+    constexpr auto
+    reindexed(sliced_view_t<Sequence, i...> view, std::index_sequence<j...>) {
+        constexpr std::size_t indices[] = {i..., 0}; // avoid empty array
+        return sliced_view_t<Sequence, indices[j]...>{view.sequence_};
+    }
+}} // end namespace experimental::detail
+
 template <>
 struct drop_front_impl<experimental::view_tag> {
+    template <std::size_t n, typename View, std::size_t ...i>
+    static constexpr auto drop_front_helper(View view, std::index_sequence<i...>) {
+        return experimental::detail::reindexed(view, std::index_sequence<(n + i)...>{});
+    }
+
     template <typename View, typename N>
     static constexpr auto apply(View view, N const&) {
+        constexpr auto Length = decltype(hana::length(view))::value;
+        constexpr auto n = N::value < Length ? N::value : Length;
+        return drop_front_helper<n>(view, std::make_index_sequence<Length - n>{});
+    }
+};
+
+template <>
+struct take_front_impl<experimental::view_tag> {
+    template <typename View, typename N>
+    static constexpr auto apply(View view, N const&) {
+        constexpr auto Length = decltype(hana::length(view))::value;
+        constexpr auto n = N::value < Length ? N::value : Length;
+        return experimental::detail::reindexed(view, std::make_index_sequence<n>{});
+    }
+};
+
+template <>
+struct reverse_impl<experimental::view_tag> {
+    template <std::size_t Length, typename View, std::size_t ...i>
+    static constexpr auto reverse_helper(View view, std::index_sequence<i...>) {
+        return experimental::detail::reindexed(view,
+                            std::index_sequence<(Length - i - 1)...>{});
+    }
+
+    template <typename View>
+    static constexpr auto apply(View view) {
+        constexpr auto Length = decltype(hana::length(view))::value;
+        return reverse_helper<Length>(view, std::make_index_sequence<Length>{});
+    }
+};
+
+template <>
+struct remove_at_impl<experimental::view_tag> {
+    template <std::size_t n, typename View, std::size_t ...i>
+    static constexpr auto remove_at_helper(View view, std::index_sequence<i...>) {
+        return experimental::detail::reindexed(view,
+                            std::index_sequence<(i < n ? i : i + 1)...>{});
+    }
+
+    template <typename View, typename N>
+    static constexpr auto apply(View view, N const&) {
+        constexpr auto Length = decltype(hana::length(view))::value;
         constexpr auto n = N::value;
+        static_assert(n < Length,
+        "hana::remove_at(view, n) requires 'n' to be in the bounds of the view");
+        return remove_at_helper<n>(view, std::make_index_sequence<Length - 1>{});
+    }
+};
+
+template <>
+struct sort_impl<experimental::view_tag> {
+    template <typename View, typename Pred>
+    static constexpr auto apply(View view, Pred const&) {
+        constexpr auto Length = decltype(hana::length(view))::value;
+        using Indices = typename hana::detail::sort_helper<
+            hana::detail::sort_predicate<View&, Pred>,
+            std::make_index_sequence<Length>
+        >::type;
+        return experimental::detail::reindexed(view, Indices{});
+    }
+
+    template <typename View>
+    static constexpr auto apply(View view)
+    { return sort_impl::apply(view, hana::less); }
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Searchable
+//////////////////////////////////////////////////////////////////////////
+template <>
+struct find_if_impl<experimental::view_tag> {
+    // Look for the index of the first matching element instead of dropping
+    // elements one by one, which would create a new view at each step.
+    template <typename View, typename Pred>
+    static constexpr auto apply(View view, Pred&&) {
         constexpr auto Length = decltype(hana::length(view))::value;
-        return experimental::sliced(view, hana::range_c<std::size_t, n, Length>);
+        return hana::detail::advance_until<View&, Pred&&, 0, Length, false>
+                    ::apply(view);
     }
 };
 
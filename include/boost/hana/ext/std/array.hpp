@@ -10,17 +10,28 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_EXT_STD_ARRAY_HPP
 #define BOOST_HANA_EXT_STD_ARRAY_HPP
 
+#include <boost/hana/all_of.hpp>
+#include <boost/hana/any_of.hpp>
 #include <boost/hana/bool.hpp>
+#include <boost/hana/concept/constant.hpp>
 #include <boost/hana/config.hpp>
+#include <boost/hana/count_if.hpp>
 #include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/fold_right.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
 #include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/for_each.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
 #include <boost/hana/fwd/length.hpp>
 #include <boost/hana/fwd/less.hpp>
+#include <boost/hana/fwd/plus.hpp>
+#include <boost/hana/fwd/transform.hpp>
+#include <boost/hana/fwd/zero.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/sum.hpp>
 
 #include <array>
 #include <cstddef>
@@ -53,13 +64,25 @@ namespace std {
     //!
     //! 3. `Foldable`\n
     //! Folding an array from the left is equivalent to calling
-    //! `std::accumulate` on it, except it can be `constexpr`.
+    //! `std::accumulate` on it, except it can be `constexpr`. Since the
+    //! elements of an array all have the same type, `for_each`, `count_if`,
+    //! `sum` and folds whose accumulator keeps the same type are done with
+    //! a plain loop instead of instantiating one call per element.
     //! @include example/ext/std/array/foldable.cpp
     //!
     //! 4. `Iterable`\n
     //! Iterating over a `std::array` is equivalent to iterating over it with
     //! a normal `for` loop.
     //! @include example/ext/std/array/iterable.cpp
+    //!
+    //! 5. `Functor`\n
+    //! Transforming a `std::array` with a function `f` returns a `std::array`
+    //! holding the results of `f`, which must all have the same type.
+    //!
+    //! 6. `Searchable`\n
+    //! `any_of` and `all_of` are done with a short-circuiting loop, unless
+    //! the predicate returns a compile-time `Logical`, in which case the
+    //! result is also known at compile-time.
     template <typename T, std::size_t N>
     struct array { };
 }
@@ -77,6 +100,60 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Whether folding `f` over elements of type `X` with an accumulator
+        // of type `S` keeps returning a `std::decay_t<S>`. When this is the
+        // case and that type can be assigned to, the fold can be written as
+        // a loop over the array. The second step is only checked when the
+        // first one returns a `std::decay_t<S>` to avoid calling `f` with
+        // arguments the generic fold never uses.
+        template <typename F, typename S, typename X,
+                  typename State = typename std::decay<S>::type,
+                  bool = std::is_same<
+                    decltype(std::declval<F&>()(std::declval<S>(), std::declval<X>())),
+                    State
+                  >::value>
+        struct array_foldl_loop : std::false_type { };
+
+        template <typename F, typename S, typename X, typename State>
+        struct array_foldl_loop<F, S, X, State, true>
+            : std::integral_constant<bool,
+                std::is_move_assignable<State>::value &&
+                std::is_same<
+                    decltype(std::declval<F&>()(std::declval<State>(), std::declval<X>())),
+                    State
+                >::value
+            >
+        { };
+
+        template <typename F, typename S, typename X,
+                  typename State = typename std::decay<S>::type,
+                  bool = std::is_same<
+                    decltype(std::declval<F&>()(std::declval<X>(), std::declval<S>())),
+                    State
+                  >::value>
+        struct array_foldr_loop : std::false_type { };
+
+        template <typename F, typename S, typename X, typename State>
+        struct array_foldr_loop<F, S, X, State, true>
+            : std::integral_constant<bool,
+                std::is_move_assignable<State>::value &&
+                std::is_same<
+                    decltype(std::declval<F&>()(std::declval<X>(), std::declval<State>())),
+                    State
+                >::value
+            >
+        { };
+
+        template <typename Xs>
+        using array_size = std::tuple_size<
+            typename std::remove_cv<typename std::remove_reference<Xs>::type>::type
+        >;
+
+        template <typename Xs>
+        using array_element = decltype(std::declval<Xs>()[0]);
+    }
+
     template <>
     struct length_impl<ext::std::array_tag> {
         template <typename Xs>
@@ -85,6 +162,196 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct fold_left_impl<ext::std::array_tag> {
+        using Generic = fold_left_impl<ext::std::array_tag, when<true>>;
+
+        // with state
+        template <typename Xs, typename S, typename F>
+        static constexpr auto loop(std::true_type, Xs&& xs, S&& s, F&& f) {
+            typename std::decay<S>::type state = f(static_cast<S&&>(s), xs[0]);
+            for (std::size_t i = 1; i < detail::array_size<Xs>::value; ++i)
+                state = f(static_cast<decltype(state)&&>(state), xs[i]);
+            return state;
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) loop(std::false_type, Xs&& xs, S&& s, F&& f) {
+            return Generic::apply(static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                                  static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using Loop = std::integral_constant<bool,
+                (detail::array_size<Xs>::value >= 2) &&
+                detail::array_foldl_loop<F, S&&, detail::array_element<Xs>>::value
+            >;
+            return fold_left_impl::loop(Loop{}, static_cast<Xs&&>(xs),
+                                        static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+
+        // without state
+        template <typename Xs, typename F>
+        static constexpr auto loop(std::true_type, Xs&& xs, F&& f) {
+            auto state = f(xs[0], xs[1]);
+            for (std::size_t i = 2; i < detail::array_size<Xs>::value; ++i)
+                state = f(static_cast<decltype(state)&&>(state), xs[i]);
+            return state;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) loop(std::false_type, Xs&& xs, F&& f) {
+            return Generic::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using X = detail::array_element<Xs>;
+            using Loop = std::integral_constant<bool,
+                (detail::array_size<Xs>::value >= 3) &&
+                detail::array_foldl_loop<F, X, X>::value
+            >;
+            return fold_left_impl::loop(Loop{}, static_cast<Xs&&>(xs),
+                                        static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct fold_right_impl<ext::std::array_tag> {
+        using Generic = fold_right_impl<ext::std::array_tag, when<true>>;
+
+        // with state
+        template <typename Xs, typename S, typename F>
+        static constexpr auto loop(std::true_type, Xs&& xs, S&& s, F&& f) {
+            constexpr std::size_t n = detail::array_size<Xs>::value;
+            typename std::decay<S>::type state = f(xs[n - 1], static_cast<S&&>(s));
+            for (std::size_t i = n - 1; i != 0; --i)
+                state = f(xs[i - 1], static_cast<decltype(state)&&>(state));
+            return state;
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) loop(std::false_type, Xs&& xs, S&& s, F&& f) {
+            return Generic::apply(static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                                  static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using Loop = std::integral_constant<bool,
+                (detail::array_size<Xs>::value >= 2) &&
+                detail::array_foldr_loop<F, S&&, detail::array_element<Xs>>::value
+            >;
+            return fold_right_impl::loop(Loop{}, static_cast<Xs&&>(xs),
+                                         static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+
+        // without state
+        template <typename Xs, typename F>
+        static constexpr auto loop(std::true_type, Xs&& xs, F&& f) {
+            constexpr std::size_t n = detail::array_size<Xs>::value;
+            auto state = f(xs[n - 2], xs[n - 1]);
+            for (std::size_t i = n - 2; i != 0; --i)
+                state = f(xs[i - 1], static_cast<decltype(state)&&>(state));
+            return state;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) loop(std::false_type, Xs&& xs, F&& f) {
+            return Generic::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using X = detail::array_element<Xs>;
+            using Loop = std::integral_constant<bool,
+                (detail::array_size<Xs>::value >= 3) &&
+                detail::array_foldr_loop<F, X, X>::value
+            >;
+            return fold_right_impl::loop(Loop{}, static_cast<Xs&&>(xs),
+                                         static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::array_tag> {
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            for (std::size_t i = 0; i < detail::array_size<Xs>::value; ++i)
+                (void)f(xs[i]);
+        }
+    };
+
+    template <>
+    struct count_if_impl<ext::std::array_tag> {
+        template <typename Xs, typename Pred>
+        static constexpr std::size_t loop(std::false_type, Xs&& xs, Pred&& pred) {
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < detail::array_size<Xs>::value; ++i)
+                if (pred(xs[i]))
+                    ++total;
+            return total;
+        }
+
+        // If the predicate returns a compile-time `Logical` (or if there are
+        // no elements), the result must be known at compile-time, so we use
+        // the generic implementation.
+        template <typename Xs, typename Pred>
+        static constexpr auto loop(std::true_type, Xs&& xs, Pred&& pred) {
+            return count_if_impl<ext::std::array_tag, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using Result = decltype(pred(std::declval<detail::array_element<Xs>>()));
+            using Generic = std::integral_constant<bool,
+                detail::array_size<Xs>::value == 0 || hana::Constant<Result>::value
+            >;
+            return count_if_impl::loop(Generic{}, static_cast<Xs&&>(xs),
+                                       static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct sum_impl<ext::std::array_tag> {
+        // `zero<M>()` usually differs in type from the elements, so we add
+        // the first element to it before looping over the remaining ones.
+        template <typename Xs, typename State>
+        static constexpr State loop_from(Xs&& xs, State state) {
+            for (std::size_t i = 1; i < detail::array_size<Xs>::value; ++i)
+                state = hana::plus(static_cast<State&&>(state), xs[i]);
+            return state;
+        }
+
+        template <typename M, typename Xs>
+        static constexpr decltype(auto) loop(std::false_type, Xs&& xs) {
+            return sum_impl<ext::std::array_tag, when<true>>::template apply<M>(
+                static_cast<Xs&&>(xs));
+        }
+
+        template <typename M, typename Xs>
+        static constexpr decltype(auto) loop(std::true_type, Xs&& xs) {
+            return sum_impl::loop_from(static_cast<Xs&&>(xs),
+                                       hana::plus(hana::zero<M>(), xs[0]));
+        }
+
+        template <typename M, typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using X = detail::array_element<Xs>;
+            using State = decltype(hana::plus(hana::zero<M>(), std::declval<X>()));
+            using Loop = std::integral_constant<bool,
+                (detail::array_size<Xs>::value >= 2) &&
+                std::is_same<
+                    decltype(hana::plus(std::declval<State>(), std::declval<X>())),
+                    State
+                >::value
+            >;
+            return sum_impl::loop<M>(Loop{}, static_cast<Xs&&>(xs));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -126,6 +393,90 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<ext::std::array_tag> {
+        // Assigning to the elements of a `std::array` is not `constexpr` in
+        // C++14, so we build the result in place from a single pack expansion
+        // instead of a loop; this still avoids going through `unpack`.
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr auto transform_helper(Xs&& xs, F&& f, std::index_sequence<i...>) {
+            using U = typename std::decay<
+                decltype(f(std::declval<detail::array_element<Xs>>()))
+            >::type;
+            return std::array<U, sizeof...(i)>{{f(xs[i])...}};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            return transform_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                std::make_index_sequence<detail::array_size<Xs>::value>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct any_of_impl<ext::std::array_tag> {
+        template <typename Xs, typename Pred>
+        static constexpr bool loop(std::false_type, Xs&& xs, Pred&& pred) {
+            for (std::size_t i = 0; i < detail::array_size<Xs>::value; ++i)
+                if (pred(xs[i]))
+                    return true;
+            return false;
+        }
+
+        // Since an array contains homogeneous data, if the predicate returns
+        // a compile-time `Logical` for one element, it does so for all of
+        // them. The generic implementation then computes a compile-time
+        // result.
+        template <typename Xs, typename Pred>
+        static constexpr auto loop(std::true_type, Xs&& xs, Pred&& pred) {
+            return any_of_impl<ext::std::array_tag, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using Result = decltype(pred(std::declval<detail::array_element<Xs>>()));
+            using Generic = std::integral_constant<bool,
+                detail::array_size<Xs>::value == 0 || hana::Constant<Result>::value
+            >;
+            return any_of_impl::loop(Generic{}, static_cast<Xs&&>(xs),
+                                     static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct all_of_impl<ext::std::array_tag> {
+        template <typename Xs, typename Pred>
+        static constexpr bool loop(std::false_type, Xs&& xs, Pred&& pred) {
+            for (std::size_t i = 0; i < detail::array_size<Xs>::value; ++i)
+                if (!pred(xs[i]))
+                    return false;
+            return true;
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto loop(std::true_type, Xs&& xs, Pred&& pred) {
+            return all_of_impl<ext::std::array_tag, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using Result = decltype(pred(std::declval<detail::array_element<Xs>>()));
+            using Generic = std::integral_constant<bool,
+                detail::array_size<Xs>::value == 0 || hana::Constant<Result>::value
+            >;
+            return all_of_impl::loop(Generic{}, static_cast<Xs&&>(xs),
+                                     static_cast<Pred&&>(pred));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Comparable
     //////////////////////////////////////////////////////////////////////////
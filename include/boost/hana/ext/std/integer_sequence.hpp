@@ -11,15 +11,38 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_EXT_STD_INTEGER_SEQUENCE_HPP
 
 #include <boost/hana/bool.hpp>
+#include <boost/hana/concept/integral_constant.hpp>
 #include <boost/hana/config.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/dependent_on.hpp>
 #include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
+#include <boost/hana/detail/merge_sort.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
 #include <boost/hana/fwd/at.hpp>
+#include <boost/hana/fwd/concat.hpp>
+#include <boost/hana/fwd/contains.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/drop_back.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
 #include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/filter.hpp>
+#include <boost/hana/fwd/find.hpp>
+#include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
+#include <boost/hana/fwd/maximum.hpp>
+#include <boost/hana/fwd/minimum.hpp>
+#include <boost/hana/fwd/remove_at.hpp>
+#include <boost/hana/fwd/reverse.hpp>
+#include <boost/hana/fwd/sort.hpp>
+#include <boost/hana/fwd/sum.hpp>
+#include <boost/hana/fwd/take_front.hpp>
+#include <boost/hana/fwd/unique.hpp>
 #include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/optional.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -56,6 +79,20 @@ namespace std {
     //! Searching through an `integer_sequence` is equivalent to searching
     //! through the corresponding sequence of `std::integral_constant`s.
     //! @include example/ext/std/integer_sequence/searchable.cpp
+    //!
+    //!
+    //! Algorithms on the values
+    //! ------------------------
+    //! The following algorithms are computed directly on the values of the
+    //! `integer_sequence`, using `constexpr` arrays instead of creating an
+    //! `integral_constant` per element: `sum`, `maximum`, `minimum`,
+    //! `contains` and `find` (when searching for an `IntegralConstant`),
+    //! and `sort`, `reverse`, `unique`, `filter`, `concat`, `take_front`,
+    //! `drop_back`, `insert` and `remove_at`, which all return a new
+    //! `std::integer_sequence`. When `sort` and `unique` are given a custom
+    //! predicate, or when `filter` is used, the predicate must return a
+    //! compile-time `Logical`. Similarly, the element given to `insert`
+    //! must be an `IntegralConstant`.
     template <typename T, T ...v>
     struct integer_sequence { };
 }
@@ -135,6 +172,369 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(std::integer_sequence<T, xs...> const&)
         { return hana::bool_c<sizeof...(xs) == 0>; }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Algorithms computed on the values
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // integer_sequence_values:
+        //  Holds the values of a `std::integer_sequence` in a `constexpr`
+        //  array, so they can be accessed by index without instantiating
+        //  anything per element.
+        template <typename T, T ...v>
+        struct integer_sequence_values {
+            static constexpr detail::array<T, sizeof...(v)> values{{v...}};
+        };
+
+        // integer_sequence_select:
+        //  Returns the `std::integer_sequence` holding the values at the
+        //  indices given by `Indices::indices`, in that order.
+        template <typename T, typename Values, typename Indices, std::size_t ...i>
+        constexpr std::integer_sequence<T, Values::values[Indices::indices[i]]...>
+        integer_sequence_select(std::index_sequence<i...>)
+        { return {}; }
+
+        template <typename T, typename Values, typename Indices>
+        constexpr auto integer_sequence_select() {
+            return detail::integer_sequence_select<T, Values, Indices>(
+                std::make_index_sequence<Indices::indices.size()>{}
+            );
+        }
+
+        // integer_sequence_predicate:
+        //  Returns the compile-time result of `pred` applied to the
+        //  `std::integral_constant`s holding the given values.
+        template <typename Pred, typename T, T ...v>
+        using integer_sequence_predicate = typename detail::decay<decltype(
+            std::declval<Pred&>()(std::integral_constant<T, v>{}...)
+        )>::type;
+    }
+
+    template <>
+    struct sum_impl<ext::std::integer_sequence_tag> {
+        template <typename T, std::size_t N>
+        static constexpr T sum_helper(detail::array<T, N> const& values) {
+            T result{};
+            for (std::size_t i = 0; i != N; ++i)
+                result += values[i];
+            return result;
+        }
+
+        template <typename U, typename T, T ...v>
+        static constexpr auto
+        apply_impl(integral_constant_tag<U>*, std::integer_sequence<T, v...> const&) {
+            using R = typename std::common_type<U, T>::type;
+            constexpr detail::array<R, sizeof...(v)> values{{v...}};
+            return hana::integral_c<R, sum_helper(values)>;
+        }
+
+        template <typename M, typename Xs>
+        static constexpr auto apply_impl(M*, Xs const& xs) {
+            using Generic = detail::dependent_on_t<sizeof(M) != 0,
+                sum_impl<ext::std::integer_sequence_tag, when<true>>
+            >;
+            return Generic::template apply<M>(xs);
+        }
+
+        template <typename M, typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return sum_impl::apply_impl(static_cast<M*>(nullptr), xs); }
+    };
+
+    template <>
+    struct maximum_impl<ext::std::integer_sequence_tag> {
+        template <typename T, std::size_t N>
+        static constexpr T maximum_helper(detail::array<T, N> const& values) {
+            T result = values[0];
+            for (std::size_t i = 1; i != N; ++i)
+                if (result < values[i])
+                    result = values[i];
+            return result;
+        }
+
+        template <typename T, T ...v>
+        static constexpr auto apply(std::integer_sequence<T, v...> const&) {
+            static_assert(sizeof...(v) > 0,
+            "hana::maximum(xs) requires 'xs' to be non-empty");
+            using Values = detail::integer_sequence_values<T, v...>;
+            return std::integral_constant<T, maximum_helper(Values::values)>{};
+        }
+    };
+
+    template <>
+    struct minimum_impl<ext::std::integer_sequence_tag> {
+        template <typename T, T ...v>
+        static constexpr auto apply(std::integer_sequence<T, v...> const&) {
+            static_assert(sizeof...(v) > 0,
+            "hana::minimum(xs) requires 'xs' to be non-empty");
+            using Values = detail::integer_sequence_values<T, v...>;
+            constexpr T const* min = detail::min_element(
+                Values::values.begin(), Values::values.end()
+            );
+            return std::integral_constant<T, *min>{};
+        }
+    };
+
+    template <>
+    struct find_impl<ext::std::integer_sequence_tag> {
+        template <typename T, T ...v, typename N>
+        static constexpr auto
+        apply_impl(hana::true_, std::integer_sequence<T, v...> const&, N const&) {
+            constexpr bool found[] = {(v == N::value)..., false};
+            constexpr std::size_t index =
+                detail::find(found, found + sizeof...(v), true) - found;
+            return helper<T, v...>(hana::bool_c<(index < sizeof...(v))>,
+                                   std::integral_constant<std::size_t, index>{});
+        }
+
+        template <typename T, T ...v, typename Index>
+        static constexpr auto helper(hana::true_, Index) {
+            using Values = detail::integer_sequence_values<T, v...>;
+            return hana::just(std::integral_constant<T, Values::values[Index::value]>{});
+        }
+
+        template <typename T, T ...v, typename Index>
+        static constexpr auto helper(hana::false_, Index)
+        { return hana::nothing; }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply_impl(hana::false_, Xs const& xs, N const& n) {
+            using Generic = detail::dependent_on_t<sizeof(N) != 0,
+                find_impl<ext::std::integer_sequence_tag, when<true>>
+            >;
+            return Generic::apply(xs, n);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs const& xs, N const& n) {
+            return find_impl::apply_impl(
+                hana::bool_c<hana::IntegralConstant<N>::value>, xs, n);
+        }
+    };
+
+    template <>
+    struct contains_impl<ext::std::integer_sequence_tag> {
+        template <typename T, T ...v, typename N>
+        static constexpr auto
+        apply_impl(hana::true_, std::integer_sequence<T, v...> const&, N const&) {
+            constexpr bool found[] = {(v == N::value)..., false};
+            return hana::bool_c<
+                detail::find(found, found + sizeof...(v), true) != found + sizeof...(v)
+            >;
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply_impl(hana::false_, Xs const& xs, N const& n) {
+            using Generic = detail::dependent_on_t<sizeof(N) != 0,
+                contains_impl<ext::std::integer_sequence_tag, when<true>>
+            >;
+            return Generic::apply(xs, n);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs const& xs, N const& n) {
+            return contains_impl::apply_impl(
+                hana::bool_c<hana::IntegralConstant<N>::value>, xs, n);
+        }
+    };
+
+    template <>
+    struct sort_impl<ext::std::integer_sequence_tag> {
+        template <typename T, T ...v>
+        struct sorted_values {
+            static constexpr detail::array<T, sizeof...(v)> values =
+                detail::integer_sequence_values<T, v...>::values.sort();
+        };
+
+        template <typename T, typename Values, std::size_t ...i>
+        static constexpr std::integer_sequence<T, Values::values[i]...>
+        helper(std::index_sequence<i...>) { return {}; }
+
+        template <typename Pred, typename T, typename Values>
+        struct sort_predicate {
+            template <std::size_t i, std::size_t j>
+            using apply = detail::integer_sequence_predicate<Pred, T,
+                Values::values[i], Values::values[j]
+            >;
+        };
+
+        template <typename T, T ...v>
+        static constexpr auto apply(std::integer_sequence<T, v...> const&) {
+            return helper<T, sorted_values<T, v...>>(
+                std::make_index_sequence<sizeof...(v)>{}
+            );
+        }
+
+        template <typename T, T ...v, typename Pred>
+        static constexpr auto
+        apply(std::integer_sequence<T, v...> const&, Pred const&) {
+            using Values = detail::integer_sequence_values<T, v...>;
+            using Indices = typename detail::sort_helper<
+                sort_predicate<Pred, T, Values>,
+                std::make_index_sequence<sizeof...(v)>
+            >::type;
+            return helper<T, Values>(Indices{});
+        }
+    };
+
+    template <>
+    struct reverse_impl<ext::std::integer_sequence_tag> {
+        template <typename T, typename Values, std::size_t ...i>
+        static constexpr std::integer_sequence<
+            T, Values::values[sizeof...(i) - i - 1]...
+        > helper(std::index_sequence<i...>) { return {}; }
+
+        template <typename T, T ...v>
+        static constexpr auto apply(std::integer_sequence<T, v...> const&) {
+            return helper<T, detail::integer_sequence_values<T, v...>>(
+                std::make_index_sequence<sizeof...(v)>{}
+            );
+        }
+    };
+
+    template <>
+    struct unique_impl<ext::std::integer_sequence_tag> {
+        // Keeps the first element, and every element that is not equal
+        // (according to `Equal`) to the element preceding it.
+        template <typename T, typename Values, typename Equal, std::size_t ...i>
+        static constexpr auto helper(std::index_sequence<i...>) {
+            using Indices = detail::filter_indices<true, !static_cast<bool>(
+                Equal::template apply<Values::values[i], Values::values[i + 1]>::value
+            )...>;
+            return detail::integer_sequence_select<T, Values, Indices>();
+        }
+
+        template <typename T>
+        struct equal_values {
+            template <T x, T y>
+            using apply = hana::bool_<x == y>;
+        };
+
+        template <typename Pred, typename T>
+        struct equal_pred {
+            template <T x, T y>
+            using apply = detail::integer_sequence_predicate<Pred, T, x, y>;
+        };
+
+        template <typename Equal, typename T>
+        static constexpr std::integer_sequence<T>
+        apply_impl(std::integer_sequence<T> const&)
+        { return {}; }
+
+        template <typename Equal, typename T, T v, T ...vs>
+        static constexpr auto
+        apply_impl(std::integer_sequence<T, v, vs...> const&) {
+            return helper<T, detail::integer_sequence_values<T, v, vs...>, Equal>(
+                std::make_index_sequence<sizeof...(vs)>{}
+            );
+        }
+
+        template <typename T, T ...v>
+        static constexpr auto apply(std::integer_sequence<T, v...> const& xs)
+        { return apply_impl<equal_values<T>>(xs); }
+
+        template <typename T, T ...v, typename Pred>
+        static constexpr auto
+        apply(std::integer_sequence<T, v...> const& xs, Pred const&)
+        { return apply_impl<equal_pred<Pred, T>>(xs); }
+    };
+
+    template <>
+    struct filter_impl<ext::std::integer_sequence_tag> {
+        template <typename T, T ...v, typename Pred>
+        static constexpr auto
+        apply(std::integer_sequence<T, v...> const&, Pred const&) {
+            using Indices = detail::filter_indices<static_cast<bool>(
+                detail::integer_sequence_predicate<Pred, T, v>::value
+            )...>;
+            return detail::integer_sequence_select<
+                T, detail::integer_sequence_values<T, v...>, Indices
+            >();
+        }
+    };
+
+    template <>
+    struct concat_impl<ext::std::integer_sequence_tag> {
+        template <typename T, T ...v, typename U, U ...u>
+        static constexpr auto
+        apply(std::integer_sequence<T, v...> const&, std::integer_sequence<U, u...> const&) {
+            using R = typename std::common_type<T, U>::type;
+            return std::integer_sequence<R, v..., u...>{};
+        }
+    };
+
+    template <>
+    struct take_front_impl<ext::std::integer_sequence_tag> {
+        template <typename T, typename Values, std::size_t ...i>
+        static constexpr std::integer_sequence<T, Values::values[i]...>
+        helper(std::index_sequence<i...>) { return {}; }
+
+        template <typename T, T ...v, typename N>
+        static constexpr auto apply(std::integer_sequence<T, v...> const&, N const&) {
+            constexpr std::size_t n = N::value;
+            constexpr std::size_t len = sizeof...(v);
+            return helper<T, detail::integer_sequence_values<T, v...>>(
+                std::make_index_sequence<(n < len ? n : len)>{}
+            );
+        }
+    };
+
+    template <>
+    struct drop_back_impl<ext::std::integer_sequence_tag> {
+        template <typename T, T ...v, typename N>
+        static constexpr auto apply(std::integer_sequence<T, v...> const&, N const&) {
+            constexpr std::size_t n = N::value;
+            constexpr std::size_t len = sizeof...(v);
+            return take_front_impl<ext::std::integer_sequence_tag>::helper<
+                T, detail::integer_sequence_values<T, v...>
+            >(std::make_index_sequence<(n < len ? len - n : 0)>{});
+        }
+    };
+
+    template <>
+    struct insert_impl<ext::std::integer_sequence_tag> {
+        template <typename T, typename Values, std::size_t n, T e, std::size_t ...i>
+        static constexpr std::integer_sequence<T,
+            (i < n ? Values::values[i] : i == n ? e : Values::values[i - 1])...
+        > helper(std::index_sequence<i...>) { return {}; }
+
+        template <typename T, T ...v, typename N, typename Element>
+        static constexpr auto
+        apply(std::integer_sequence<T, v...> const&, N const&, Element const&) {
+            static_assert(hana::IntegralConstant<Element>::value,
+            "hana::insert(xs, n, element) requires 'element' to be an "
+            "IntegralConstant when 'xs' is a std::integer_sequence");
+
+            constexpr std::size_t n = N::value;
+            static_assert(n <= sizeof...(v),
+            "hana::insert(xs, n, element) requires 'n' to be in the bounds "
+            "of the sequence");
+
+            constexpr T e = Element::value;
+            return helper<T, detail::integer_sequence_values<T, v...>, n, e>(
+                std::make_index_sequence<sizeof...(v) + 1>{}
+            );
+        }
+    };
+
+    template <>
+    struct remove_at_impl<ext::std::integer_sequence_tag> {
+        template <typename T, typename Values, std::size_t n, std::size_t ...i>
+        static constexpr std::integer_sequence<T,
+            Values::values[i < n ? i : i + 1]...
+        > helper(std::index_sequence<i...>) { return {}; }
+
+        template <typename T, T ...v, typename N>
+        static constexpr auto apply(std::integer_sequence<T, v...> const&, N const&) {
+            constexpr std::size_t n = N::value;
+            static_assert(n < sizeof...(v),
+            "hana::remove_at(xs, n) requires 'n' to be in the bounds of the sequence");
+
+            return helper<T, detail::integer_sequence_values<T, v...>, n>(
+                std::make_index_sequence<sizeof...(v) - 1>{}
+            );
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_EXT_STD_INTEGER_SEQUENCE_HPP
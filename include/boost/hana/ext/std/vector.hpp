@@ -14,9 +14,15 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/count_if.hpp>
+#include <boost/hana/fwd/fold_left.hpp>
+#include <boost/hana/fwd/fold_right.hpp>
+#include <boost/hana/fwd/for_each.hpp>
+#include <boost/hana/fwd/transform.hpp>
 #include <boost/hana/less.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -24,6 +30,49 @@ Distributed under the Boost Software License, Version 1.0.
 #include <vector>
 
 
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+namespace std {
+    //! @ingroup group-ext-std
+    //! Adaptation of `std::vector` for Hana.
+    //!
+    //! Since the size of a `std::vector` is only known at runtime, it can't
+    //! model the concepts whose methods must return compile-time results,
+    //! like `Iterable` or `Searchable`. However, it can be used with the
+    //! algorithms that only need to visit its elements.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Comparable`\n
+    //! `std::vector`s are compared as per `std::equal`, except that two
+    //! vectors with different sizes compare unequal and elements are
+    //! compared with `hana::equal`.
+    //!
+    //! 2. `Orderable`\n
+    //! `std::vector`s are ordered with the usual lexicographical ordering,
+    //! with elements compared with `hana::less`.
+    //!
+    //! 3. `Functor`\n
+    //! Transforming a `std::vector` returns a `std::vector` of the results,
+    //! using the same allocator rebound to the new element type. The result
+    //! is allocated exactly once. When the vector is an rvalue, its elements
+    //! are moved into the function, and if the function returns elements of
+    //! the same type, the vector is modified in place and returned.
+    //!
+    //! 4. `Foldable`\n
+    //! `fold_left`, `fold_right`, `for_each` and `count_if` are done with a
+    //! loop over the vector. The accumulator of a fold has the type returned
+    //! by the first call to the function, and the state must be convertible
+    //! to that type so it can be returned for an empty vector. The versions
+    //! of `fold_left` and `fold_right` without a state require the vector
+    //! to be non-empty. When the vector is an rvalue, its elements are moved
+    //! into the function.
+    template <typename T, typename Allocator>
+    class vector { };
+}
+#endif
+
+
 BOOST_HANA_NAMESPACE_BEGIN
     namespace ext { namespace std { struct vector_tag; }}
 
@@ -62,49 +111,180 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
-#if 0
+    namespace detail {
+        // Iterators over the elements of a vector of type `V`, which move
+        // the elements out when `V` is an rvalue, like accessing the elements
+        // of an rvalue `hana::tuple` does.
+        template <typename V, bool = std::is_lvalue_reference<V>::value>
+        struct vector_iterators {
+            template <typename Vec>
+            static auto begin(Vec& v) { return v.begin(); }
+
+            template <typename Vec>
+            static auto end(Vec& v) { return v.end(); }
+
+            template <typename Vec>
+            static auto rbegin(Vec& v) { return v.rbegin(); }
+
+            template <typename Vec>
+            static auto rend(Vec& v) { return v.rend(); }
+        };
+
+        template <typename V>
+        struct vector_iterators<V, false> {
+            template <typename Vec>
+            static auto begin(Vec& v) { return std::make_move_iterator(v.begin()); }
+
+            template <typename Vec>
+            static auto end(Vec& v) { return std::make_move_iterator(v.end()); }
+
+            template <typename Vec>
+            static auto rbegin(Vec& v) { return std::make_move_iterator(v.rbegin()); }
+
+            template <typename Vec>
+            static auto rend(Vec& v) { return std::make_move_iterator(v.rend()); }
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Functor
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct transform_impl<ext::std::vector_tag> {
         template <typename V, typename F>
-        static auto apply(V&& v, F&& f) {
-            using U = std::remove_cv_t<std::remove_reference_t<
-                decltype(f(*v.begin()))
-            >>;
-            using Alloc = typename std::remove_reference_t<V>::allocator_type;
+        static auto transform_helper(std::false_type, V&& v, F&& f) {
+            using Iterators = detail::vector_iterators<V>;
+            using U = typename std::decay<decltype(f(*Iterators::begin(v)))>::type;
+            using Alloc = typename std::remove_reference<V>::type::allocator_type;
             using NewAlloc = typename std::allocator_traits<Alloc>::
                              template rebind_alloc<U>;
-            std::vector<U, NewAlloc> result; result.reserve(v.size());
 
-            std::transform(begin(v), end(v),
-                           std::back_inserter(result), std::forward<F>(f));
+            std::vector<U, NewAlloc> result(NewAlloc(v.get_allocator()));
+            result.reserve(v.size());
+            for (auto it = Iterators::begin(v); it != Iterators::end(v); ++it)
+                result.push_back(f(*it));
             return result;
         }
 
-        template <typename T, typename Alloc, typename F>
-        static auto apply(std::vector<T, Alloc>&& v, F&& f)
-            -> std::enable_if_t<
-                std::is_same<
-                    T,
-                    std::remove_cv_t<std::remove_reference_t<
-                        decltype(f(*v.begin()))
-                    >>
-                >{}
-                , std::vector<T, Alloc>
-            >
-        {
-            // If we receive a rvalue and the function returns elements of
-            // the same type, we modify the vector in-place instead of
-            // returning a new one.
-            std::transform(std::make_move_iterator(begin(v)),
-                           std::make_move_iterator(end(v)),
-                           begin(v), std::forward<F>(f));
+        // If we receive an rvalue and the function returns elements of the
+        // same type, we modify the vector in-place instead of returning a
+        // new one.
+        template <typename V, typename F>
+        static auto transform_helper(std::true_type, V&& v, F&& f) {
+            for (auto it = v.begin(); it != v.end(); ++it)
+                *it = f(std::move(*it));
             return std::move(v);
         }
+
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            using Iterators = detail::vector_iterators<V>;
+            using T = typename std::remove_reference<V>::type::value_type;
+            using U = typename std::decay<decltype(f(*Iterators::begin(v)))>::type;
+            using InPlace = std::integral_constant<bool,
+                !std::is_lvalue_reference<V>::value &&
+                !std::is_const<typename std::remove_reference<V>::type>::value &&
+                std::is_same<T, U>::value
+            >;
+            return transform_helper(InPlace{}, static_cast<V&&>(v),
+                                               static_cast<F&&>(f));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct fold_left_impl<ext::std::vector_tag> {
+        // with state
+        template <typename V, typename S, typename F>
+        static auto apply(V&& v, S&& s, F&& f) {
+            using Iterators = detail::vector_iterators<V>;
+            auto first = Iterators::begin(v);
+            auto last = Iterators::end(v);
+            using Acc = typename std::decay<
+                decltype(f(static_cast<S&&>(s), *first))
+            >::type;
+
+            if (first == last)
+                return Acc(static_cast<S&&>(s));
+
+            Acc acc = f(static_cast<S&&>(s), *first);
+            for (++first; first != last; ++first)
+                acc = f(std::move(acc), *first);
+            return acc;
+        }
+
+        // without state
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            using Iterators = detail::vector_iterators<V>;
+            auto first = Iterators::begin(v);
+            auto last = Iterators::end(v);
+
+            typename std::remove_reference<V>::type::value_type acc = *first;
+            for (++first; first != last; ++first)
+                acc = f(std::move(acc), *first);
+            return acc;
+        }
+    };
+
+    template <>
+    struct fold_right_impl<ext::std::vector_tag> {
+        // with state
+        template <typename V, typename S, typename F>
+        static auto apply(V&& v, S&& s, F&& f) {
+            using Iterators = detail::vector_iterators<V>;
+            auto first = Iterators::rbegin(v);
+            auto last = Iterators::rend(v);
+            using Acc = typename std::decay<
+                decltype(f(*first, static_cast<S&&>(s)))
+            >::type;
+
+            if (first == last)
+                return Acc(static_cast<S&&>(s));
+
+            Acc acc = f(*first, static_cast<S&&>(s));
+            for (++first; first != last; ++first)
+                acc = f(*first, std::move(acc));
+            return acc;
+        }
+
+        // without state
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            using Iterators = detail::vector_iterators<V>;
+            auto first = Iterators::rbegin(v);
+            auto last = Iterators::rend(v);
+
+            typename std::remove_reference<V>::type::value_type acc = *first;
+            for (++first; first != last; ++first)
+                acc = f(*first, std::move(acc));
+            return acc;
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::vector_tag> {
+        template <typename V, typename F>
+        static void apply(V&& v, F&& f) {
+            using Iterators = detail::vector_iterators<V>;
+            for (auto it = Iterators::begin(v); it != Iterators::end(v); ++it)
+                (void)f(*it);
+        }
+    };
+
+    template <>
+    struct count_if_impl<ext::std::vector_tag> {
+        template <typename V, typename Pred>
+        static std::size_t apply(V const& v, Pred&& pred) {
+            std::size_t total = 0;
+            for (auto const& x : v)
+                if (pred(x))
+                    ++total;
+            return total;
+        }
     };
-#endif
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_EXT_STD_VECTOR_HPP
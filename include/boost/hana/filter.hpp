@@ -12,22 +12,17 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/filter.hpp>
 
-#include <boost/hana/at.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/chain.hpp>
 #include <boost/hana/concept/monad_plus.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/core/make.hpp>
-#include <boost/hana/detail/algorithm.hpp>
-#include <boost/hana/detail/array.hpp>
-#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
 #include <boost/hana/empty.hpp>
 #include <boost/hana/lift.hpp>
 #include <boost/hana/unpack.hpp>
 
-#include <cstddef>
 #include <utility>
 
 
@@ -37,11 +32,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto filter_t::operator()(Xs&& xs, Pred&& pred) const {
         using M = typename hana::tag_of<Xs>::type;
         using Filter = BOOST_HANA_DISPATCH_IF(filter_impl<M>,
-            hana::MonadPlus<M>::value
+            (hana::MonadPlus<M>::value || !is_default<filter_impl<M>>::value)
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::MonadPlus<M>::value,
+        static_assert((hana::MonadPlus<M>::value || !is_default<filter_impl<M>>::value),
         "hana::filter(xs, pred) requires 'xs' to be a MonadPlus");
     #endif
 
@@ -79,55 +74,15 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
-    namespace detail {
-        template <bool ...b>
-        struct filter_indices {
-            static constexpr auto compute_indices() {
-                constexpr bool bs[] = {b..., false}; // avoid empty array
-                constexpr std::size_t N = detail::count(bs, bs + sizeof(bs), true);
-                detail::array<std::size_t, N> indices{};
-                std::size_t* keep = &indices[0];
-                for (std::size_t i = 0; i < sizeof...(b); ++i)
-                    if (bs[i])
-                        *keep++ = i;
-                return indices;
-            }
-
-            static constexpr auto indices = compute_indices();
-        };
-
-        template <typename Pred>
-        struct make_filter_indices {
-            Pred const& pred;
-            template <typename ...X>
-            auto operator()(X&& ...x) const -> filter_indices<
-                static_cast<bool>(detail::decay<
-                    decltype(pred(static_cast<X&&>(x)))
-                >::type::value)...
-            > { return {}; }
-        };
-    }
-
     template <typename S>
     struct filter_impl<S, when<Sequence<S>::value>> {
-        template <typename Indices, typename Xs, std::size_t ...i>
-        static constexpr auto filter_helper(Xs&& xs, std::index_sequence<i...>) {
-            return hana::make<S>(
-                hana::at_c<Indices::indices[i]>(static_cast<Xs&&>(xs))...
-            );
-        }
-
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred const& pred) {
             using Indices = decltype(
                 hana::unpack(static_cast<Xs&&>(xs),
                              detail::make_filter_indices<Pred>{pred})
             );
-
-            return filter_impl::filter_helper<Indices>(
-                static_cast<Xs&&>(xs),
-                std::make_index_sequence<Indices::indices.size()>{}
-            );
+            return detail::make_from_indices<S, Indices>(static_cast<Xs&&>(xs));
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -12,11 +12,21 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/find.hpp>
 
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/searchable.hpp>
+#include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/struct_key_index.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/find_if.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/second.hpp>
+
+#include <cstddef>
+#include <type_traits>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -56,6 +66,41 @@ BOOST_HANA_NAMESPACE_BEGIN
                                  detail::equal_to<Key>{key});
         }
     };
+
+    template <typename S>
+    struct find_impl<S, when<hana::Struct<S>::value>> {
+        // When the keys are Hashable, the accessor is found through the key
+        // index of the Struct, which is built once per Struct.
+        template <typename X>
+        static constexpr auto helper(X&&, hana::optional<>)
+        { return hana::nothing; }
+
+        template <typename X, std::size_t i>
+        static constexpr auto
+        helper(X&& x, hana::optional<std::integral_constant<std::size_t, i>>) {
+            return hana::just(hana::second(hana::at_c<i>(hana::accessors<S>()))(
+                static_cast<X&&>(x)
+            ));
+        }
+
+        template <typename X, typename Key>
+        static constexpr auto apply_impl(X&& x, Key const&, hana::true_) {
+            using MaybeIndex = typename struct_detail::key_index<S>::template find<Key>;
+            return helper(static_cast<X&&>(x), MaybeIndex{});
+        }
+
+        template <typename X, typename Key>
+        static constexpr auto apply_impl(X&& x, Key const& key, hana::false_) {
+            return hana::find_if(static_cast<X&&>(x),
+                                 detail::equal_to<Key>{key});
+        }
+
+        template <typename X, typename Key>
+        static constexpr auto apply(X&& x, Key const& key) {
+            using Indexable = typename struct_detail::key_index<S>::template indexable<Key>;
+            return apply_impl(static_cast<X&&>(x), key, hana::bool_c<Indexable::value>);
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_FIND_HPP
@@ -128,7 +128,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! members are equal. By default, a model of `Comparable` doing just that
     //! is provided for models of `Struct`. In particular, note that the
     //! comparison of the members is made in the same order as they appear in
-    //! the `hana::members` sequence.
+    //! the `hana::members` sequence, and it stops at the first pair of
+    //! members that are not equal. When all the accessors of `S` refer to
+    //! data members that can be compared bitwise and that make up the whole
+    //! object (no padding), the objects are compared with `std::memcmp`
+    //! instead, provided the compiler can tell whether `S` has padding.
     //! @include example/struct/comparable.cpp
     //!
     //! 2. `Foldable` (free model)\n
@@ -149,6 +153,13 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! members associated to those names. By default, a model of `Searchable`
     //! is provided for any model of the `Struct` concept.
     //! @include example/struct/searchable.cpp
+    //!
+    //! 4. `Orderable` (free model)\n
+    //! `Struct`s of the same data type are ordered lexicographically, by
+    //! comparing their members in the same order as they appear in the
+    //! `hana::members` sequence. The comparison stops at the first pair of
+    //! members for which one is less than the other. This model is only
+    //! usable when the members themselves are `Orderable`.
     template <typename S>
     struct Struct;
 BOOST_HANA_NAMESPACE_END
@@ -14,6 +14,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/core/make.hpp>
 #include <boost/hana/fwd/integral_constant.hpp>
 
+#include <cstddef>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
 #ifdef BOOST_HANA_DOXYGEN_INVOKED
@@ -31,6 +33,19 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! range does not have to start at zero. The only requirement is that
     //! `from <= to`.
     //!
+    //! A range may also have a non-zero `step`, in which case it contains
+    //! the values `from, from+step, from+2*step, ...` up to but excluding
+    //! `to`. When `step` is negative, the values are decreasing and the
+    //! requirement becomes `from >= to`. For example, the range going from
+    //! `10` to `0` with a step of `-3` contains `10, 7, 4, 1`.
+    //!
+    //! Since a range only stores its bounds and its step, a few algorithms
+    //! that are not part of the concepts below are also provided on ranges
+    //! and return a new range without ever creating the values in it.
+    //! Those are `reverse`, `take_front`, `drop_back`, `slice` when the
+    //! indices are themselves a `range`, and `filter` when the values
+    //! satisfying the predicate are evenly spaced, like with `x % m == r`.
+    //!
     //! @note
     //! The representation of `hana::range` is implementation defined. In
     //! particular, one should not take for granted the number and types
@@ -42,7 +57,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! ----------------
     //! 1. `Comparable`\n
     //! Two ranges are equal if and only if they are both empty or they both
-    //! span the same interval.
+    //! contain the same values in the same order.
     //! @include example/range/comparable.cpp
     //!
     //! 2. `Foldable`\n
@@ -62,7 +77,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! Searching a `range` is equivalent to searching a list of the values
     //! in the range `[from, to)`, but it is much more compile-time efficient.
     //! @include example/range/searchable.cpp
-    template <typename T, T from, T to>
+    template <typename T, T from, T to, std::ptrdiff_t step = 1>
     struct range {
         //! Equivalent to `hana::equal`
         template <typename X, typename Y>
@@ -77,8 +92,21 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator[](N&& n);
     };
 #else
-    template <typename T, T from, T to>
+    template <typename T, T from, T to, std::ptrdiff_t step = 1>
     struct range;
+
+    namespace detail {
+        template <typename T, T from, T to, std::ptrdiff_t step>
+        struct checked_range {
+            static_assert(step < 0 || from <= to,
+            "hana::make_range(from, to) requires 'from <= to'");
+
+            static_assert(step > 0 || from >= to,
+            "hana::make_range(from, to, step) requires 'from >= to' when 'step' is negative");
+
+            using type = range<T, from, to, step>;
+        };
+    }
 #endif
 
     //! Tag representing a `hana::range`.
@@ -99,12 +127,17 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! the created range contains `integral_constant`s whose underlying
     //! type is their common type.
     //!
+    //! An optional `IntegralConstant` `step` may also be given, in which
+    //! case the created range contains the values `from, from+step, ...`
+    //! up to but excluding `to`. `step` must be non-zero, and when it is
+    //! negative, `from >= to` must be true instead.
+    //!
     //!
     //! Example
     //! -------
     //! @include example/range/make.cpp
     template <>
-    constexpr auto make<range_tag> = [](auto const& from, auto const& to) {
+    constexpr auto make<range_tag> = [](auto const& from, auto const& to[, auto const& step]) {
         return range<implementation_defined>{implementation_defined};
     };
 #endif
@@ -117,9 +150,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @relates hana::range
     //!
     //! This shorthand is provided for convenience only and it is equivalent
-    //! to `make_range`. Specifically, `range_c<T, from, to>` is such that
+    //! to `make_range`. Specifically, `range_c<T, from, to, step>` is such that
     //! @code
-    //!     range_c<T, from, to> == make_range(integral_c<T, from>, integral_c<T, to>)
+    //!     range_c<T, from, to, step> == make_range(integral_c<T, from>, integral_c<T, to>,
+    //!                                              integral_c<std::ptrdiff_t, step>)
     //! @endcode
     //!
     //!
@@ -133,16 +167,20 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @tparam to
     //! The exclusive upper bound of the created range.
     //!
+    //! @tparam step
+    //! The non-zero step of the created range, which defaults to 1.
+    //!
     //!
     //! Example
     //! -------
     //! @include example/range/range_c.cpp
 #ifdef BOOST_HANA_DOXYGEN_INVOKED
-    template <typename T, T from, T to>
-    constexpr auto range_c = make_range(integral_c<T, from>, integral_c<T, to>);
+    template <typename T, T from, T to, std::ptrdiff_t step = 1>
+    constexpr auto range_c = make_range(integral_c<T, from>, integral_c<T, to>,
+                                        integral_c<std::ptrdiff_t, step>);
 #else
-    template <typename T, T from, T to>
-    constexpr range<T, from, to> range_c{};
+    template <typename T, T from, T to, std::ptrdiff_t step = 1>
+    constexpr typename detail::checked_range<T, from, to, step>::type range_c{};
 #endif
 BOOST_HANA_NAMESPACE_END
 
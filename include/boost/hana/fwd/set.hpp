@@ -93,7 +93,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator[](Key&& key);
     };
 #else
-    template <typename ...Xs>
+    template <typename HashTable, typename Storage>
     struct set;
 #endif
 
@@ -208,6 +208,12 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! compile-time optimizations. Also note that the type of the objects
     //! returned by `tuple_c` and an equivalent call to `make<tuple_tag>` may differ.
     //!
+    //! @note
+    //! Algorithms like `sort`, `unique` or `maximum` still compare the
+    //! elements of a `tuple_c` pair by pair. For large packs of constants,
+    //! consider `hana::experimental::integers`, which operates on a
+    //! `constexpr` array of the values instead.
+    //!
     //!
     //! Example
     //! -------
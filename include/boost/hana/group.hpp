@@ -17,8 +17,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
-#include <boost/hana/detail/algorithm.hpp>
-#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
 #include <boost/hana/equal.hpp>
 #include <boost/hana/length.hpp>
@@ -62,11 +62,35 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @endcond
 
     namespace detail {
-        template <typename Xs, std::size_t ...i>
-        constexpr auto get_subsequence_(Xs&& xs, std::index_sequence<i...>) {
-            using S = typename hana::tag_of<Xs>::type;
-            return hana::make<S>(hana::at_c<i>(static_cast<Xs&&>(xs))...);
-        }
+        // group_starts:
+        //  The `filter_indices` of the elements of `Xs` that start a new
+        //  group, i.e. the first element and every element that is not
+        //  equivalent to the element preceding it according to `Pred`.
+        //  This is shared by `group` and `unique`.
+        template <typename Xs, typename Pred, typename Indices>
+        struct group_starts;
+
+        template <typename Xs, typename Pred>
+        struct group_starts<Xs, Pred, std::index_sequence<>> {
+            using type = detail::filter_indices<>;
+        };
+
+        template <typename Xs, typename Pred, std::size_t ...i>
+        struct group_starts<Xs, Pred, std::index_sequence<0, i...>> {
+            using type = detail::filter_indices<true, !static_cast<bool>(
+                detail::decay<decltype(std::declval<Pred&>()(
+                    hana::at_c<i - 1>(std::declval<Xs>()),
+                    hana::at_c<i>(std::declval<Xs>())
+                ))>::type::value
+            )...>;
+        };
+
+        template <typename Xs, typename Pred>
+        using group_starts_t = typename group_starts<
+            Xs, Pred, std::make_index_sequence<
+                decltype(hana::length(std::declval<Xs>()))::value
+            >
+        >::type;
 
         template <std::size_t offset, typename Indices>
         struct offset_by;
@@ -76,37 +100,27 @@ BOOST_HANA_NAMESPACE_BEGIN
             using type = std::index_sequence<(offset + i)...>;
         };
 
-        template <bool ...b>
-        struct group_indices {
-            static constexpr bool bs[] = {b...};
-            static constexpr std::size_t n_groups =
-                    detail::count(bs, bs + sizeof(bs), false) + 1;
-
-            static constexpr auto compute_info() {
-                detail::array<std::size_t, n_groups> sizes{}, offsets{};
-                for (std::size_t g = 0, i = 0, offset = 0; g < n_groups; ++g) {
-                    offsets[g] = offset;
+        template <typename S, typename Starts, std::size_t Length>
+        struct group_from_starts {
+            static constexpr std::size_t n_groups = Starts::indices.size();
 
-                    sizes[g] = 1;
-                    while (i < sizeof...(b) && bs[i++])
-                        ++sizes[g];
-
-                    offset += sizes[g];
-                }
-                return std::make_pair(offsets, sizes);
+            static constexpr std::size_t group_size(std::size_t g) {
+                return (g + 1 < n_groups ? Starts::indices[g + 1] : Length)
+                        - Starts::indices[g];
             }
 
-            static constexpr auto info = compute_info();
-            static constexpr auto offsets = info.first;
-            static constexpr auto group_sizes = info.second;
+            template <typename Xs, std::size_t ...i>
+            static constexpr auto subsequence(Xs&& xs, std::index_sequence<i...>)
+            { return hana::make<S>(hana::at_c<i>(static_cast<Xs&&>(xs))...); }
 
-            template <typename S, typename Xs, std::size_t ...i>
-            static constexpr auto finish(Xs&& xs, std::index_sequence<i...>) {
+            template <typename Xs, std::size_t ...g>
+            static constexpr auto apply(Xs&& xs, std::index_sequence<g...>) {
                 return hana::make<S>(
-                    detail::get_subsequence_(
+                    group_from_starts::subsequence(
                         static_cast<Xs&&>(xs),
                         typename offset_by<
-                            offsets[i], std::make_index_sequence<group_sizes[i]>
+                            Starts::indices[g],
+                            std::make_index_sequence<group_size(g)>
                         >::type{}
                     )...
                 );
@@ -116,36 +130,13 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <typename S, bool condition>
     struct group_impl<S, when<condition>> : default_ {
-        template <typename Xs, typename Pred, std::size_t ...i>
-        static constexpr auto
-        group_helper(Xs&& xs, Pred&& pred, std::index_sequence<0, i...>) {
-            using info = detail::group_indices<static_cast<bool>(decltype(
-                pred(hana::at_c<i - 1>(static_cast<Xs&&>(xs)),
-                     hana::at_c<i>(static_cast<Xs&&>(xs)))
-            )::value)...>;
-            return info::template finish<S>(static_cast<Xs&&>(xs),
-                std::make_index_sequence<info::n_groups>{}
-            );
-        }
-
-        template <typename Xs, typename Pred>
-        static constexpr auto
-        group_helper(Xs&& xs, Pred&&, std::index_sequence<0>) {
-            return hana::make<S>(static_cast<Xs&&>(xs));
-        }
-
-        template <typename Xs, typename Pred>
-        static constexpr auto
-        group_helper(Xs&&, Pred&&, std::index_sequence<>) {
-            return hana::make<S>();
-        }
-
         template <typename Xs, typename Pred>
-        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            using Starts = detail::group_starts_t<Xs&&, Pred>;
             constexpr std::size_t len = decltype(hana::length(xs))::value;
-            return group_helper(static_cast<Xs&&>(xs),
-                                static_cast<Pred&&>(pred),
-                                std::make_index_sequence<len>{});
+            using Groups = detail::group_from_starts<S, Starts, len>;
+            return Groups::apply(static_cast<Xs&&>(xs),
+                std::make_index_sequence<Groups::n_groups>{});
         }
 
         template <typename Xs>
@@ -12,12 +12,15 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/less.hpp>
 
+#include <boost/hana/accessors.hpp>
 #include <boost/hana/and.hpp>
+#include <boost/hana/at.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/concept/constant.hpp>
 #include <boost/hana/concept/orderable.hpp>
 #include <boost/hana/concept/product.hpp>
 #include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/common.hpp>
 #include <boost/hana/core/to.hpp>
@@ -28,12 +31,15 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/equal.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/if.hpp>
+#include <boost/hana/length.hpp>
 #include <boost/hana/less_equal.hpp>
 #include <boost/hana/lexicographical_compare.hpp>
 #include <boost/hana/or.hpp>
 #include <boost/hana/second.hpp>
 #include <boost/hana/value.hpp>
 
+#include <cstddef>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -137,6 +143,84 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(Xs const& xs, Ys const& ys)
         { return hana::lexicographical_compare(xs, ys); }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Model for Structs
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Compares the members of two Structs lexicographically, in the order
+        // of their accessors. Like `compare_struct_members` in `equal.hpp`,
+        // this stops at the first pair of members that are not equivalent,
+        // and it produces a compile-time result if all the members that need
+        // to be looked at are compared at compile-time.
+        template <typename X, typename Y, typename Accessors, std::size_t Length>
+        struct less_struct_members {
+            X const& x;
+            Y const& y;
+            Accessors const& accessors;
+
+            template <std::size_t i, typename A, typename B>
+            constexpr auto less(A const& a, B const& b) const {
+                auto const& accessor = hana::second(hana::at_c<i>(accessors));
+                return hana::if_(hana::less(accessor(a), accessor(b)),
+                                 hana::true_c, hana::false_c);
+            }
+
+            template <std::size_t i>
+            constexpr auto apply(hana::true_) const
+            { return hana::false_c; }
+
+            template <std::size_t i>
+            constexpr auto apply(hana::false_) const {
+                return less_struct_members::less_than<i>(
+                    less_struct_members::less<i>(x, y)
+                );
+            }
+
+            // x_i < y_i
+            template <std::size_t i>
+            constexpr auto less_than(hana::true_) const
+            { return hana::true_c; }
+
+            template <std::size_t i>
+            constexpr auto less_than(hana::false_) const {
+                return less_struct_members::greater_than<i>(
+                    less_struct_members::less<i>(y, x)
+                );
+            }
+
+            template <std::size_t i>
+            constexpr bool less_than(bool b) const {
+                return b || static_cast<bool>(less_struct_members::less_than<i>(hana::false_c));
+            }
+
+            // y_i < x_i
+            template <std::size_t i>
+            constexpr auto greater_than(hana::true_) const
+            { return hana::false_c; }
+
+            template <std::size_t i>
+            constexpr auto greater_than(hana::false_) const
+            { return less_struct_members::apply<i+1>(hana::bool_c<i+1 == Length>); }
+
+            template <std::size_t i>
+            constexpr bool greater_than(bool b) const {
+                return !b && static_cast<bool>(less_struct_members::greater_than<i>(hana::false_c));
+            }
+        };
+    }
+
+    template <typename S>
+    struct less_impl<S, S, when<hana::Struct<S>::value>> {
+        template <typename X, typename Y>
+        static constexpr auto apply(X const& x, Y const& y) {
+            auto accessors = hana::accessors<S>();
+            constexpr std::size_t length = decltype(hana::length(accessors))::value;
+            detail::less_struct_members<X, Y, decltype(accessors), length>
+                comp{x, y, accessors};
+            return comp.template apply<0>(hana::bool_c<length == 0>);
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_LESS_HPP
@@ -35,7 +35,6 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/first.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/functional/demux.hpp>
-#include <boost/hana/functional/on.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/fwd/any_of.hpp>
 #include <boost/hana/fwd/at_key.hpp>
@@ -47,7 +46,6 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/keys.hpp>
 #include <boost/hana/length.hpp>
 #include <boost/hana/optional.hpp>
-#include <boost/hana/remove_if.hpp>
 #include <boost/hana/second.hpp>
 #include <boost/hana/unpack.hpp>
 #include <boost/hana/value.hpp>
@@ -129,9 +127,6 @@ BOOST_HANA_NAMESPACE_BEGIN
             "hana::make_map(pairs...) requires all the keys to be "
             "Comparable at compile-time");
 
-            //! @todo
-            //! This can be implemented more efficiently by doing the check
-            //! inside each bucket instead.
             static_assert(!detail::has_duplicates<decltype(hana::first(pairs))...>::value,
             "hana::make_map({keys, values}...) requires all the keys to be unique");
 
@@ -176,16 +171,8 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct insert_impl<map_tag> {
-        template <typename Map, typename Pair>
-        static constexpr auto helper(Map&& map, Pair&& pair, ...) {
-            using RawMap = typename std::remove_reference<Map>::type;
-            using HashTable = typename RawMap::hash_table_type;
-            using NewHashTable = typename detail::bucket_insert<
-                HashTable,
-                decltype(hana::first(pair)),
-                decltype(hana::length(map.storage))::value
-            >::type;
-
+        template <typename Map, typename Pair, typename NewHashTable>
+        static constexpr auto helper(Map&& map, Pair&& pair, NewHashTable, hana::optional<>) {
             using NewStorage = decltype(
                 hana::append(static_cast<Map&&>(map).storage, static_cast<Pair&&>(pair))
             );
@@ -194,28 +181,27 @@ BOOST_HANA_NAMESPACE_BEGIN
             );
         }
 
-        template <typename Map, typename Pair, std::size_t i>
+        template <typename Map, typename Pair, typename NewHashTable, std::size_t i>
         static constexpr auto
-        helper(Map&& map, Pair&&,
+        helper(Map&& map, Pair&&, NewHashTable,
                hana::optional<std::integral_constant<std::size_t, i>>)
         {
             return static_cast<Map&&>(map);
         }
 
-        //! @todo
-        //! Here, we insert only if the key is not already in the map.
-        //! This should be handled by `bucket_insert`, and that would also
-        //! be more efficient.
         template <typename Map, typename Pair>
         static constexpr auto apply(Map&& map, Pair&& pair) {
             using RawMap = typename std::remove_reference<Map>::type;
             using Storage = typename RawMap::storage_type;
             using HashTable = typename RawMap::hash_table_type;
-            using Key = decltype(hana::first(pair));
-            using MaybeIndex = typename detail::find_index<
-              HashTable, Key, detail::KeyAtIndex<Storage>::template apply
-            >::type;
-            return helper(static_cast<Map&&>(map), static_cast<Pair&&>(pair), MaybeIndex{});
+            using Insert = detail::bucket_insert<
+                HashTable,
+                decltype(hana::first(pair)),
+                decltype(hana::length(map.storage))::value,
+                detail::KeyAtIndex<Storage>::template apply
+            >;
+            return helper(static_cast<Map&&>(map), static_cast<Pair&&>(pair),
+                          typename Insert::type{}, typename Insert::found{});
         }
     };
 
@@ -224,30 +210,48 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<map_tag> {
-        //! @todo
-        //! We could implement some kind of `bucket_erase` metafunction
-        //! that would be much more efficient than this.
         template <typename Map, typename Key>
-        static constexpr auto
-        erase_key_helper(Map&& map, Key const&, hana::false_) {
+        static constexpr auto helper(Map&& map, Key const&, ...) {
             return static_cast<Map&&>(map);
         }
 
-        template <typename Map, typename Key>
+        template <typename NewHashTable, typename Map, std::size_t ...before, std::size_t ...after>
         static constexpr auto
-        erase_key_helper(Map&& map, Key const& key, hana::true_) {
-            return hana::unpack(
-                hana::remove_if(static_cast<Map&&>(map).storage,
-                                hana::on(hana::equal.to(key), hana::first)),
-                hana::make_map
-            );
+        erase_helper(Map&& map, std::index_sequence<before...>,
+                                std::index_sequence<after...>)
+        {
+            using NewStorage = decltype(hana::make_basic_tuple(
+                hana::at_c<before>(static_cast<Map&&>(map).storage)...,
+                hana::at_c<after + sizeof...(before) + 1>(static_cast<Map&&>(map).storage)...
+            ));
+            return hana::map<NewHashTable, NewStorage>(hana::make_basic_tuple(
+                hana::at_c<before>(static_cast<Map&&>(map).storage)...,
+                hana::at_c<after + sizeof...(before) + 1>(static_cast<Map&&>(map).storage)...
+            ));
+        }
+
+        template <typename Map, typename Key, std::size_t i>
+        static constexpr auto
+        helper(Map&& map, Key const&, hana::optional<std::integral_constant<std::size_t, i>>) {
+            using RawMap = typename std::remove_reference<Map>::type;
+            using NewHashTable = typename detail::bucket_erase<
+                typename RawMap::hash_table_type, Key, i
+            >::type;
+            constexpr std::size_t size = decltype(hana::length(map.storage))::value;
+            return erase_helper<NewHashTable>(static_cast<Map&&>(map),
+                                              std::make_index_sequence<i>{},
+                                              std::make_index_sequence<size - i - 1>{});
         }
 
         template <typename Map, typename Key>
         static constexpr auto apply(Map&& map, Key const& key) {
-            constexpr bool contains = hana::value<decltype(hana::contains(map, key))>();
-            return erase_key_helper(static_cast<Map&&>(map), key,
-                                    hana::bool_c<contains>);
+            using RawMap = typename std::remove_reference<Map>::type;
+            using Storage = typename RawMap::storage_type;
+            using HashTable = typename RawMap::hash_table_type;
+            using MaybeIndex = typename detail::find_index<
+                HashTable, Key, detail::KeyAtIndex<Storage>::template apply
+            >::type;
+            return helper(static_cast<Map&&>(map), key, MaybeIndex{});
         }
     };
 
@@ -377,14 +381,59 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // Construction from a Foldable
     //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        struct map_has_duplicate_keys {
+            template <typename ...Pairs>
+            constexpr auto operator()(Pairs const& ...) const {
+                using Storage = hana::basic_tuple<typename detail::decay<Pairs>::type...>;
+                return hana::bool_c<detail::has_duplicate_keys<
+                    KeyAtIndex<Storage>::template apply, sizeof...(Pairs)
+                >::value>;
+            }
+        };
+
+        // Creates a map from pairs whose keys are known to be unique. Unlike
+        // `make_map`, this does not require the hashes of the keys to be
+        // distinct.
+        struct make_map_from_unique_keys {
+            template <typename ...Pairs>
+            constexpr auto operator()(Pairs&& ...pairs) const {
+                using Storage = hana::basic_tuple<typename detail::decay<Pairs>::type...>;
+                using HashTable = typename detail::make_collision_safe_hash_table<
+                    KeyAtIndex<Storage>::template apply, sizeof...(Pairs)
+                >::type;
+                return hana::map<HashTable, Storage>(
+                    hana::make_basic_tuple(static_cast<Pairs&&>(pairs)...)
+                );
+            }
+        };
+    }
+
     template <typename F>
     struct to_impl<map_tag, F, when<hana::Foldable<F>::value>> {
         template <typename Xs>
-        static constexpr decltype(auto) apply(Xs&& xs) {
+        static constexpr decltype(auto) helper(Xs&& xs, hana::true_) {
             return hana::fold_left(
                 static_cast<Xs&&>(xs), hana::make_map(), hana::insert
             );
         }
+
+        template <typename Xs>
+        static constexpr auto helper(Xs&& xs, hana::false_) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                                detail::make_map_from_unique_keys{});
+        }
+
+        // When there are no duplicate keys, which can be checked by only
+        // comparing keys whose hashes collide, the map is created in one
+        // shot instead of inserting the pairs one by one.
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using HasDuplicates = decltype(
+                hana::unpack(xs, detail::map_has_duplicate_keys{})
+            );
+            return helper(static_cast<Xs&&>(xs), HasDuplicates{});
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
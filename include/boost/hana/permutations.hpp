@@ -48,6 +48,26 @@ BOOST_HANA_NAMESPACE_BEGIN
             static constexpr auto value =
                 detail::array<std::size_t, N>{}.iota(0).permutations();
         };
+
+        // nth_permutation:
+        //  Returns the `n`-th permutation of `0, ..., N-1`, in the same
+        //  (lexicographical) order as `permutation_indices`. The permutation
+        //  is decoded from the digits of `n` in the factorial number system,
+        //  so the other permutations are never computed.
+        template <std::size_t N>
+        constexpr detail::array<std::size_t, N> nth_permutation(std::size_t n) {
+            detail::array<std::size_t, N> remaining = detail::array<std::size_t, N>{}.iota(0);
+            detail::array<std::size_t, N> result{};
+            for (std::size_t i = 0; i != N; ++i) {
+                std::size_t f = detail::factorial(N - 1 - i);
+                std::size_t q = n / f;
+                n %= f;
+                result[i] = remaining[q];
+                for (std::size_t j = q; j + 1 < N - i; ++j)
+                    remaining[j] = remaining[j + 1];
+            }
+            return result;
+        }
     }
 
     template <typename S, bool condition>
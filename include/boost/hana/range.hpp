@@ -24,9 +24,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/back.hpp>
 #include <boost/hana/fwd/contains.hpp>
+#include <boost/hana/fwd/drop_back.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
 #include <boost/hana/fwd/drop_front_exactly.hpp>
 #include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/filter.hpp>
 #include <boost/hana/fwd/find.hpp>
 #include <boost/hana/fwd/front.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
@@ -34,12 +36,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/maximum.hpp>
 #include <boost/hana/fwd/minimum.hpp>
 #include <boost/hana/fwd/product.hpp>
+#include <boost/hana/fwd/reverse.hpp>
+#include <boost/hana/fwd/slice.hpp>
 #include <boost/hana/fwd/sum.hpp>
+#include <boost/hana/fwd/take_front.hpp>
 #include <boost/hana/fwd/unpack.hpp>
 #include <boost/hana/integral_constant.hpp> // required by fwd decl and below
 #include <boost/hana/optional.hpp>
 #include <boost/hana/value.hpp>
 
+#include <climits>
 #include <cstddef>
 #include <utility>
 
@@ -48,23 +54,98 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // range<>
     //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Arithmetic on the values of a range is done modulo 2^n, where `n`
+        // is the number of bits of `T`. This way, the end of a range can
+        // always be represented, even when it wraps around. For example, the
+        // end of the range going from 9 down to 0 over `std::size_t` is -1.
+        template <typename T>
+        struct range_arithmetic {
+            static constexpr unsigned long long mask =
+                sizeof(T) >= sizeof(unsigned long long)
+                    ? ~0ull
+                    : (1ull << (sizeof(T) * CHAR_BIT)) - 1;
+
+            static constexpr unsigned long long abs(std::ptrdiff_t step) {
+                return step > 0 ? static_cast<unsigned long long>(step)
+                                : static_cast<unsigned long long>(-(step + 1)) + 1;
+            }
+
+            // Returns the `n`-th value of the range starting at `from` with
+            // the given `step`.
+            static constexpr T nth(T from, std::ptrdiff_t step, unsigned long long n) {
+                return static_cast<T>(static_cast<unsigned long long>(from) +
+                                      n * static_cast<unsigned long long>(step));
+            }
+
+            // Returns an end for the range starting at `from` with the given
+            // `step` and `length`, i.e. one past its last value. Stepping once
+            // more past the last value instead could wrap around beyond
+            // `from` when `length * step` does not fit in `T`, which would
+            // change the length of the range.
+            static constexpr T end(T from, std::ptrdiff_t step, std::size_t length) {
+                return length == 0 ? from : static_cast<T>(
+                    static_cast<unsigned long long>(nth(from, step, length - 1)) +
+                    (step > 0 ? 1ull : ~0ull)
+                );
+            }
+
+            // Returns the number of values in the range `[from, to)` with the
+            // given `step`, i.e. the number of steps needed to reach or cross
+            // `to`, starting from `from`.
+            static constexpr std::size_t
+            length(T from, T to, std::ptrdiff_t step) {
+                unsigned long long distance = (step > 0
+                    ? static_cast<unsigned long long>(to) - static_cast<unsigned long long>(from)
+                    : static_cast<unsigned long long>(from) - static_cast<unsigned long long>(to)
+                ) & mask;
+                return static_cast<std::size_t>(
+                    distance / abs(step) + (distance % abs(step) != 0)
+                );
+            }
+
+            // Returns the index of `n` in the range starting at `from` with
+            // the given `step` and length, or `length` if `n` is not in it.
+            template <typename N>
+            static constexpr std::size_t
+            index_of(T from, std::ptrdiff_t step, std::size_t length, N n) {
+                if (length == 0 || (step > 0 ? n < from : n > from))
+                    return length;
+                unsigned long long distance = step > 0
+                    ? static_cast<unsigned long long>(n) - static_cast<unsigned long long>(from)
+                    : static_cast<unsigned long long>(from) - static_cast<unsigned long long>(n);
+                if (distance % abs(step) != 0 || distance / abs(step) >= length)
+                    return length;
+                return static_cast<std::size_t>(distance / abs(step));
+            }
+        };
+
+        template <typename T, T From, std::ptrdiff_t Step, std::size_t Length>
+        using make_range_from_length = range<T, From,
+            range_arithmetic<T>::end(From, Step, Length), Step
+        >;
+    }
+
     //! @cond
-    template <typename T, T From, T To>
+    template <typename T, T From, T To, std::ptrdiff_t Step>
     struct range
-        : detail::operators::adl<range<T, From, To>>
-        , detail::iterable_operators<range<T, From, To>>
+        : detail::operators::adl<range<T, From, To, Step>>
+        , detail::iterable_operators<range<T, From, To, Step>>
     {
-        static_assert(From <= To,
-        "hana::make_range(from, to) requires 'from <= to'");
+        static_assert(Step != 0,
+        "hana::make_range(from, to, step) requires 'step' to be non-zero");
 
         using value_type = T;
         static constexpr value_type from = From;
         static constexpr value_type to = To;
+        static constexpr std::ptrdiff_t step = Step;
+        static constexpr std::size_t size =
+            detail::range_arithmetic<T>::length(From, To, Step);
     };
     //! @endcond
 
-    template <typename T, T From, T To>
-    struct tag_of<range<T, From, To>> {
+    template <typename T, T From, T To, std::ptrdiff_t Step>
+    struct tag_of<range<T, From, To, Step>> {
         using type = range_tag;
     };
 
@@ -74,7 +155,12 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <>
     struct make_impl<range_tag> {
         template <typename From, typename To>
-        static constexpr auto apply(From const&, To const&) {
+        static constexpr auto apply(From const& from, To const& to) {
+            return make_impl::apply(from, to, hana::integral_c<std::ptrdiff_t, 1>);
+        }
+
+        template <typename From, typename To, typename Step>
+        static constexpr auto apply(From const&, To const&, Step const&) {
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
             static_assert(hana::IntegralConstant<From>::value,
@@ -82,6 +168,9 @@ BOOST_HANA_NAMESPACE_BEGIN
 
             static_assert(hana::IntegralConstant<To>::value,
             "hana::make_range(from, to) requires 'to' to be an IntegralConstant");
+
+            static_assert(hana::IntegralConstant<Step>::value,
+            "hana::make_range(from, to, step) requires 'step' to be an IntegralConstant");
         #endif
 
             using T = typename common<
@@ -90,7 +179,8 @@ BOOST_HANA_NAMESPACE_BEGIN
             >::type;
             constexpr T from = hana::to<T>(From::value);
             constexpr T to = hana::to<T>(To::value);
-            return range<T, from, to>{};
+            constexpr std::ptrdiff_t step = Step::value;
+            return typename detail::checked_range<T, from, to, step>::type{};
         }
     };
 
@@ -112,8 +202,9 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename R1, typename R2>
         static constexpr auto apply(R1 const&, R2 const&) {
             return hana::bool_c<
-                (R1::from == R1::to && R2::from == R2::to) ||
-                (R1::from == R2::from && R1::to == R2::to)
+                (R1::size == 0 && R2::size == 0) ||
+                (R1::size == R2::size && R1::from == R2::from &&
+                    (R1::size == 1 || R1::step == R2::step))
             >;
         }
     };
@@ -123,89 +214,97 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct unpack_impl<range_tag> {
-        template <typename T, T from, typename F, T ...v>
+        template <typename T, unsigned long long from, unsigned long long step,
+                  typename F, std::size_t ...i>
         static constexpr decltype(auto)
-        unpack_helper(F&& f, std::integer_sequence<T, v...>) {
-            return static_cast<F&&>(f)(integral_constant<T, from + v>{}...);
+        unpack_helper(F&& f, std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                integral_constant<T, static_cast<T>(from + i * step)>{}...
+            );
         }
 
-        template <typename T, T from, T to, typename F>
-        static constexpr decltype(auto) apply(range<T, from, to> const&, F&& f) {
-            return unpack_helper<T, from>(static_cast<F&&>(f),
-                std::make_integer_sequence<T, to - from>{});
+        template <typename T, T from, T to, std::ptrdiff_t step, typename F>
+        static constexpr decltype(auto) apply(range<T, from, to, step> const&, F&& f) {
+            return unpack_helper<T, static_cast<unsigned long long>(from),
+                                    static_cast<unsigned long long>(step)>(
+                static_cast<F&&>(f),
+                std::make_index_sequence<range<T, from, to, step>::size>{}
+            );
         }
     };
 
     template <>
     struct length_impl<range_tag> {
-        template <typename T, T from, T to>
-        static constexpr auto apply(range<T, from, to> const&)
-        { return hana::size_c<static_cast<std::size_t>(to - from)>; }
+        template <typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&)
+        { return hana::size_c<range<T, from, to, step>::size>; }
     };
 
     template <>
     struct minimum_impl<range_tag> {
-        template <typename T, T from, T to>
-        static constexpr auto apply(range<T, from, to> const&)
-        { return integral_c<T, from>; }
+        template <typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&) {
+            constexpr std::size_t n = range<T, from, to, step>::size;
+            return integral_c<T, (step > 0 ? from
+                : detail::range_arithmetic<T>::nth(from, step, n - 1))>;
+        }
     };
 
     template <>
     struct maximum_impl<range_tag> {
-        template <typename T, T from, T to>
-        static constexpr auto apply(range<T, from, to> const&)
-        { return integral_c<T, to-1>; }
+        template <typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&) {
+            constexpr std::size_t n = range<T, from, to, step>::size;
+            return integral_c<T, (step < 0 ? from
+                : detail::range_arithmetic<T>::nth(from, step, n - 1))>;
+        }
     };
 
     template <>
     struct sum_impl<range_tag> {
-        // Returns the sum of `[m, n]`, where `m <= n` always hold.
+        // Returns the sum of the arithmetic progression of `n` values going
+        // from `first` to `last`, which is `n * (first + last) / 2`. Either
+        // `n` or `first + last` is even, and we divide it first.
         template <typename I>
-        static constexpr I sum_helper(I m, I n) {
-            if (m == n)
-                return m;
-
-            // 0 == m < n
-            else if (0 == m)
-                return n * (n+1) / 2;
-
-            // 0 < m < n
-            else if (0 < m)
-                return sum_helper(0, n) - sum_helper(0, m-1);
-
-            // m < 0 <= n
-            else if (0 <= n)
-                return sum_helper(0, n) - sum_helper(0, -m);
-
-            // m < n < 0
+        static constexpr I sum_helper(std::size_t n, I first, I last) {
+            if (n == 0)
+                return 0;
+            else if (n == 1)
+                return first;
+            else if (n % 2 == 0)
+                return static_cast<I>(n / 2) * (first + last);
             else
-                return -sum_helper(-n, -m);
+                return static_cast<I>(n) * ((first + last) / 2);
         }
 
-        template <typename, typename T, T from, T to>
-        static constexpr auto apply(range<T, from, to> const&) {
-            return integral_c<T, from == to ? 0 : sum_helper(from, to-1)>;
+        template <typename, typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&) {
+            constexpr std::size_t n = range<T, from, to, step>::size;
+            return integral_c<T, sum_helper<T>(n, from,
+                detail::range_arithmetic<T>::nth(from, step, n - 1))>;
         }
     };
 
     template <>
     struct product_impl<range_tag> {
-        // Returns the product of `[m, n)`, where `m <= n` always hold.
-        template <typename I>
-        static constexpr I product_helper(I m, I n) {
-            if (m <= 0 && 0 < n)
+        // Returns the product of the `n` values starting at `from` with the
+        // given `step`, which is 0 whenever one of them is 0.
+        template <typename T>
+        static constexpr T product_helper(T from, std::ptrdiff_t step, std::size_t n) {
+            if (detail::range_arithmetic<T>::index_of(from, step, n, 0) != n)
                 return 0;
-            else {
-                I p = 1;
-                for (; m != n; ++m)
-                    p *= m;
-                return p;
-            }
+
+            T p = 1;
+            for (std::size_t i = 0; i != n; ++i)
+                p *= detail::range_arithmetic<T>::nth(from, step, i);
+            return p;
         }
 
-        template <typename, typename T, T from, T to>
-        static constexpr auto apply(range<T, from, to> const&)
-        { return integral_c<T, product_helper(from, to)>; }
+        template <typename, typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&) {
+            constexpr std::size_t n = range<T, from, to, step>::size;
+            return integral_c<T, product_helper<T>(from, step, n)>;
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -213,29 +312,33 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct find_impl<range_tag> {
-        template <typename T, T from, typename N>
+        template <typename T, typename N>
         static constexpr auto find_helper(hana::true_) {
             constexpr T n = N::value;
             return hana::just(hana::integral_c<T, n>);
         }
 
-        template <typename T, T from, typename N>
+        template <typename T, typename N>
         static constexpr auto find_helper(hana::false_)
         { return hana::nothing; }
 
-        template <typename T, T from, T to, typename N>
-        static constexpr auto apply(range<T, from, to> const&, N const&) {
-            constexpr auto n = N::value;
-            return find_helper<T, from, N>(hana::bool_c<(n >= from && n < to)>);
+        template <typename T, T from, T to, std::ptrdiff_t step, typename N>
+        static constexpr auto apply(range<T, from, to, step> const&, N const&) {
+            constexpr std::size_t size = range<T, from, to, step>::size;
+            constexpr std::size_t index =
+                detail::range_arithmetic<T>::index_of(from, step, size, N::value);
+            return find_helper<T, N>(hana::bool_c<(index != size)>);
         }
     };
 
     template <>
     struct contains_impl<range_tag> {
-        template <typename T, T from, T to, typename N>
-        static constexpr auto apply(range<T, from, to> const&, N const&) {
-            constexpr auto n = N::value;
-            return bool_c<(n >= from && n < to)>;
+        template <typename T, T from, T to, std::ptrdiff_t step, typename N>
+        static constexpr auto apply(range<T, from, to, step> const&, N const&) {
+            constexpr std::size_t size = range<T, from, to, step>::size;
+            constexpr std::size_t index =
+                detail::range_arithmetic<T>::index_of(from, step, size, N::value);
+            return bool_c<(index != size)>;
         }
     };
 
@@ -244,49 +347,191 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct front_impl<range_tag> {
-        template <typename T, T from, T to>
-        static constexpr auto apply(range<T, from, to> const&)
+        template <typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&)
         { return integral_c<T, from>; }
     };
 
     template <>
     struct is_empty_impl<range_tag> {
-        template <typename T, T from, T to>
-        static constexpr auto apply(range<T, from, to> const&)
-        { return bool_c<from == to>; }
+        template <typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&)
+        { return bool_c<range<T, from, to, step>::size == 0>; }
     };
 
     template <>
     struct at_impl<range_tag> {
-        template <typename T, T from, T to, typename N>
-        static constexpr auto apply(range<T, from, to> const&, N const&) {
+        template <typename T, T from, T to, std::ptrdiff_t step, typename N>
+        static constexpr auto apply(range<T, from, to, step> const&, N const&) {
             constexpr auto n = N::value;
-            return integral_c<T, from + n>;
+            return integral_c<T, detail::range_arithmetic<T>::nth(from, step, n)>;
         }
     };
 
     template <>
     struct back_impl<range_tag> {
-        template <typename T, T from, T to>
-        static constexpr auto apply(range<T, from, to> const&)
-        { return integral_c<T, to - 1>; }
+        template <typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&) {
+            constexpr std::size_t n = range<T, from, to, step>::size;
+            return integral_c<T, detail::range_arithmetic<T>::nth(from, step, n - 1)>;
+        }
     };
 
     template <>
     struct drop_front_impl<range_tag> {
-        template <typename T, T from, T to, typename N>
-        static constexpr auto apply(range<T, from, to> const&, N const&) {
-            constexpr auto n = N::value;
-            return range<T, (to < from + n ? to : from + n), to>{};
+        template <typename T, T from, T to, std::ptrdiff_t step, typename N>
+        static constexpr auto apply(range<T, from, to, step> const&, N const&) {
+            constexpr std::size_t size = range<T, from, to, step>::size;
+            constexpr std::size_t n = N::value < size ? N::value : size;
+            return detail::make_range_from_length<T,
+                detail::range_arithmetic<T>::nth(from, step, n), step, size - n
+            >{};
         }
     };
 
     template <>
     struct drop_front_exactly_impl<range_tag> {
-        template <typename T, T from, T to, typename N>
-        static constexpr auto apply(range<T, from, to> const&, N const&) {
-            constexpr auto n = N::value;
-            return range<T, from + n, to>{};
+        template <typename T, T from, T to, std::ptrdiff_t step, typename N>
+        static constexpr auto apply(range<T, from, to, step> const&, N const&) {
+            constexpr std::size_t size = range<T, from, to, step>::size;
+            constexpr std::size_t n = N::value;
+            return detail::make_range_from_length<T,
+                detail::range_arithmetic<T>::nth(from, step, n), step, size - n
+            >{};
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence-like algorithms
+    //
+    // A range is not a Sequence, but the following algorithms can return a
+    // new range without ever creating the values in it.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct reverse_impl<range_tag> {
+        template <typename T, T from, T to, std::ptrdiff_t step>
+        static constexpr auto apply(range<T, from, to, step> const&) {
+            constexpr std::size_t size = range<T, from, to, step>::size;
+            constexpr T last = detail::range_arithmetic<T>::nth(from, step, size - 1);
+            return detail::make_range_from_length<T,
+                (size == 0 ? from : last), -step, size
+            >{};
+        }
+    };
+
+    template <>
+    struct take_front_impl<range_tag> {
+        template <typename T, T from, T to, std::ptrdiff_t step, typename N>
+        static constexpr auto apply(range<T, from, to, step> const&, N const&) {
+            constexpr std::size_t size = range<T, from, to, step>::size;
+            constexpr std::size_t n = N::value < size ? N::value : size;
+            return detail::make_range_from_length<T, from, step, n>{};
+        }
+    };
+
+    template <>
+    struct drop_back_impl<range_tag> {
+        template <typename T, T from, T to, std::ptrdiff_t step, typename N>
+        static constexpr auto apply(range<T, from, to, step> const&, N const&) {
+            constexpr std::size_t size = range<T, from, to, step>::size;
+            constexpr std::size_t n = N::value < size ? N::value : size;
+            return detail::make_range_from_length<T, from, step, size - n>{};
+        }
+    };
+
+    template <>
+    struct slice_impl<range_tag> {
+        // Slicing a range with a range of indices `[i, j)` with step `s`
+        // returns the range starting at the `i`-th value and whose step is
+        // `s` times the original step.
+        template <typename T, T from, T to, std::ptrdiff_t step,
+                  typename I, I i, I j, std::ptrdiff_t s>
+        static constexpr auto
+        apply(range<T, from, to, step> const&, range<I, i, j, s> const&) {
+            constexpr std::size_t size = range<I, i, j, s>::size;
+            constexpr std::size_t first = static_cast<std::size_t>(i);
+            constexpr std::size_t last = static_cast<std::size_t>(
+                detail::range_arithmetic<I>::nth(i, s, size - 1));
+            static_assert(size == 0 || (first < range<T, from, to, step>::size &&
+                                        last < range<T, from, to, step>::size),
+            "hana::slice(range, indices) requires the indices to be in bounds");
+            return detail::make_range_from_length<T,
+                detail::range_arithmetic<T>::nth(from, step, first),
+                (size <= 1 ? step : step * s), size
+            >{};
+        }
+    };
+
+    template <>
+    struct filter_impl<range_tag> {
+        // Filtering a range returns a range, so the values satisfying the
+        // predicate must be evenly spaced, which is the case for predicates
+        // like `x % m == r`. The predicate must return a compile-time
+        // `Logical`; it is only called in an unevaluated context, and the
+        // values that are kept are never materialized.
+        struct spacing {
+            std::size_t first;
+            std::size_t stride;
+            std::size_t count;
+            bool evenly_spaced;
+        };
+
+        // Finds the first kept index, the distance to the next one and the
+        // number of kept indices in a first pass, and then checks that the
+        // kept indices are exactly `first + k * stride` in a second pass.
+        template <std::size_t N>
+        static constexpr spacing compute_spacing(bool const (&keep)[N], std::size_t n) {
+            spacing result{n, 1, 0, true};
+            std::size_t second = n;
+            for (std::size_t i = 0; i != n; ++i) {
+                if (!keep[i])
+                    continue;
+                if (result.count == 0)
+                    result.first = i;
+                else if (result.count == 1)
+                    second = i;
+                ++result.count;
+            }
+            if (result.count > 1)
+                result.stride = second - result.first;
+
+            for (std::size_t i = result.first; i < n; ++i) {
+                std::size_t offset = i - result.first;
+                bool expected = offset % result.stride == 0 &&
+                                offset / result.stride < result.count;
+                if (keep[i] != expected) {
+                    result.evenly_spaced = false;
+                    break;
+                }
+            }
+            return result;
+        }
+
+        template <typename T, T from, T to, std::ptrdiff_t step, typename Pred,
+                  std::size_t ...i>
+        static constexpr auto filter_helper(Pred&& pred, std::index_sequence<i...>) {
+            constexpr bool keep[] = {
+                static_cast<bool>(hana::value<decltype(pred(
+                    integral_c<T, detail::range_arithmetic<T>::nth(from, step, i)>
+                ))>())..., false // avoid empty array
+            };
+            constexpr spacing kept = compute_spacing(keep, sizeof...(i));
+            static_assert(kept.evenly_spaced,
+            "hana::filter(range, pred) requires the values satisfying 'pred' "
+            "to be evenly spaced in the range");
+
+            constexpr std::size_t first = kept.count == 0 ? 0 : kept.first;
+            return detail::make_range_from_length<T,
+                detail::range_arithmetic<T>::nth(from, step, first),
+                (kept.count <= 1 ? step : step * static_cast<std::ptrdiff_t>(kept.stride)),
+                kept.count
+            >{};
+        }
+
+        template <typename T, T from, T to, std::ptrdiff_t step, typename Pred>
+        static constexpr auto apply(range<T, from, to, step> const&, Pred&& pred) {
+            return filter_helper<T, from, to, step>(static_cast<Pred&&>(pred),
+                std::make_index_sequence<range<T, from, to, step>::size>{});
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -13,12 +13,17 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/remove.hpp>
 
 #include <boost/hana/concept/monad_plus.hpp>
+#include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/filter.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/not.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -49,6 +54,19 @@ BOOST_HANA_NAMESPACE_BEGIN
                                   hana::equal.to(static_cast<Value&&>(value))));
         }
     };
+
+    template <typename S>
+    struct remove_impl<S, when<Sequence<S>::value>> {
+        template <typename Xs, typename Value>
+        static constexpr auto apply(Xs&& xs, Value&& value) {
+            using Pred = decltype(hana::equal.to(static_cast<Value&&>(value)));
+            using Indices = decltype(hana::unpack(
+                static_cast<Xs&&>(xs),
+                detail::make_filter_indices<Pred, false>{std::declval<Pred const&>()}
+            ));
+            return detail::make_from_indices<S, Indices>(static_cast<Xs&&>(xs));
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_REMOVE_HPP
@@ -13,11 +13,14 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/remove_if.hpp>
 
 #include <boost/hana/concept/monad_plus.hpp>
+#include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
 #include <boost/hana/filter.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/not.hpp>
+#include <boost/hana/unpack.hpp>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -26,11 +29,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto remove_if_t::operator()(Xs&& xs, Pred&& pred) const {
         using M = typename hana::tag_of<Xs>::type;
         using RemoveIf = BOOST_HANA_DISPATCH_IF(remove_if_impl<M>,
-            hana::MonadPlus<M>::value
+            (hana::MonadPlus<M>::value || !is_default<remove_if_impl<M>>::value)
         );
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::MonadPlus<M>::value,
+            static_assert((hana::MonadPlus<M>::value || !is_default<remove_if_impl<M>>::value),
             "hana::remove_if(xs, predicate) requires 'xs' to be a MonadPlus");
         #endif
 
@@ -47,6 +50,17 @@ BOOST_HANA_NAMESPACE_BEGIN
                         hana::compose(hana::not_, static_cast<Pred&&>(pred)));
         }
     };
+
+    template <typename S>
+    struct remove_if_impl<S, when<Sequence<S>::value>> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred const& pred) {
+            using Indices = decltype(hana::unpack(
+                static_cast<Xs&&>(xs), detail::make_filter_indices<Pred, false>{pred}
+            ));
+            return detail::make_from_indices<S, Indices>(static_cast<Xs&&>(xs));
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_REMOVE_IF_HPP
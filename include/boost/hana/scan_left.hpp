@@ -13,13 +13,18 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/scan_left.hpp>
 
 #include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/scan.hpp>
+#include <boost/hana/detail/unpack_flatten.hpp>
 #include <boost/hana/empty.hpp>
 #include <boost/hana/length.hpp>
-#include <boost/hana/prepend.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -61,71 +66,117 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <typename S, bool condition>
     struct scan_left_impl<S, when<condition>> : default_ {
-        // Without initial state
-        template <typename Xs, typename F, std::size_t n1, std::size_t n2, std::size_t ...ns>
+        // The states are computed in steps of 4 elements, each step being
+        // one level of recursion, and the states computed by each step are
+        // kept in a `basic_tuple` until the end, where all of them are put
+        // into the resulting sequence at once. This bounds the recursion
+        // depth to a fourth of the length of the sequence, and avoids
+        // rebuilding the result at each step.
+        template <std::size_t i, std::size_t n, typename Xs, typename State,
+                  typename F, typename ...Steps>
         static constexpr auto
-        apply1_impl(Xs&& xs, F const& f, std::index_sequence<n1, n2, ns...>) {
-            static_assert(n1 == 0, "logic error in Boost.Hana: file a bug report");
+        scan_steps(Xs&& xs, State&& s0, F const& f, std::integral_constant<std::size_t, 4>, Steps&& ...steps) {
+            auto s1 = f(s0, hana::at_c<i>(static_cast<Xs&&>(xs)));
+            auto s2 = f(s1, hana::at_c<i + 1>(static_cast<Xs&&>(xs)));
+            auto s3 = f(s2, hana::at_c<i + 2>(static_cast<Xs&&>(xs)));
+            auto s4 = f(s3, hana::at_c<i + 3>(static_cast<Xs&&>(xs)));
+            return scan_left_impl::scan_steps<i + 4, n>(
+                static_cast<Xs&&>(xs), std::move(s4), f, detail::scan_step<n - i - 4>{},
+                static_cast<Steps&&>(steps)...,
+                hana::make_basic_tuple(static_cast<State&&>(s0), std::move(s1),
+                                       std::move(s2), std::move(s3))
+            );
+        }
 
-            // Use scan_left with the first element as an initial state.
-            return scan_left_impl::apply_impl(
-                static_cast<Xs&&>(xs),
-                hana::at_c<0>(static_cast<Xs&&>(xs)),
-                f, std::index_sequence<n2, ns...>{}
+        template <std::size_t i, std::size_t n, typename Xs, typename State,
+                  typename F, typename ...Steps>
+        static constexpr auto
+        scan_steps(Xs&& xs, State&& s0, F const& f, std::integral_constant<std::size_t, 1>, Steps&& ...steps) {
+            auto s1 = f(s0, hana::at_c<i>(static_cast<Xs&&>(xs)));
+            return scan_left_impl::scan_steps<i + 1, n>(
+                static_cast<Xs&&>(xs), std::move(s1), f, detail::scan_step<n - i - 1>{},
+                static_cast<Steps&&>(steps)...,
+                hana::make_basic_tuple(static_cast<State&&>(s0))
             );
         }
 
-        template <typename Xs, typename F, std::size_t n>
-        static constexpr auto apply1_impl(Xs&& xs, F const&, std::index_sequence<n>) {
-            return hana::make<S>(hana::at_c<n>(static_cast<Xs&&>(xs)));
+        template <std::size_t i, std::size_t n, typename Xs, typename State,
+                  typename F, typename ...Steps>
+        static constexpr auto
+        scan_steps(Xs&&, State&& s0, F const&, std::integral_constant<std::size_t, 0>, Steps&& ...steps) {
+            return detail::unpack_flatten(
+                hana::make_basic_tuple(static_cast<Steps&&>(steps)...,
+                    hana::make_basic_tuple(static_cast<State&&>(s0))),
+                hana::make<S>
+            );
         }
 
-        template <typename Xs, typename F>
-        static constexpr auto apply1_impl(Xs&&, F const&, std::index_sequence<>) {
-            return hana::empty<S>();
+        // When all the states have the same type, they are computed without
+        // recursion into an array, in the order of its initializers.
+        template <std::size_t Start, typename Xs, typename State, typename F, std::size_t ...i>
+        static constexpr auto
+        scan_homogeneous(Xs&& xs, State&& state, F const& f, std::index_sequence<i...>) {
+            using T = typename detail::decay<State>::type;
+            T s = state;
+            detail::array<T, sizeof...(i) + 1> states{{
+                static_cast<State&&>(state),
+                (s = f(s, hana::at_c<Start + i>(static_cast<Xs&&>(xs))))...
+            }};
+            return hana::make<S>(std::move(states[0]), std::move(states[i + 1])...);
         }
 
-        template <typename Xs, typename F>
-        static constexpr auto apply(Xs&& xs, F const& f) {
-            constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            return scan_left_impl::apply1_impl(static_cast<Xs&&>(xs),
-                                               f, std::make_index_sequence<Len>{});
+        template <std::size_t Start, std::size_t n, typename Xs, typename State, typename F>
+        static constexpr auto scan_impl(Xs&& xs, State&& state, F const& f, hana::true_) {
+            return scan_left_impl::scan_homogeneous<Start>(
+                static_cast<Xs&&>(xs), static_cast<State&&>(state), f,
+                std::make_index_sequence<n - Start>{});
         }
 
+        template <std::size_t Start, std::size_t n, typename Xs, typename State, typename F>
+        static constexpr auto scan_impl(Xs&& xs, State&& state, F const& f, hana::false_) {
+            return scan_left_impl::scan_steps<Start, n>(
+                static_cast<Xs&&>(xs), static_cast<State&&>(state), f,
+                detail::scan_step<n - Start>{});
+        }
 
-        // With initial state
-        template <typename Xs, typename State, typename F,
-                  std::size_t n1, std::size_t n2, std::size_t ...ns>
-        static constexpr auto
-        apply_impl(Xs&& xs, State&& state, F const& f,
-                   std::index_sequence<n1, n2, ns...>)
-        {
-            auto rest = scan_left_impl::apply_impl(
-                                static_cast<Xs&&>(xs),
-                                f(state, hana::at_c<n1>(static_cast<Xs&&>(xs))),
-                                f, std::index_sequence<n2, ns...>{});
-            return hana::prepend(std::move(rest), static_cast<State&&>(state));
+        // Scans the elements at indices `[Start, n)`, starting with `state`.
+        template <std::size_t Start, std::size_t n, typename Xs, typename State, typename F>
+        static constexpr auto scan(Xs&& xs, State&& state, F const& f) {
+            using Homogeneous = detail::homogeneous_scan<
+                true, Xs&&, typename detail::decay<State>::type, F, Start,
+                std::make_index_sequence<n - Start>
+            >;
+            return scan_left_impl::scan_impl<Start, n>(
+                static_cast<Xs&&>(xs), static_cast<State&&>(state), f,
+                hana::bool_c<Homogeneous::value>);
         }
 
-        template <typename Xs, typename State, typename F, std::size_t n>
-        static constexpr auto
-        apply_impl(Xs&& xs, State&& state, F const& f, std::index_sequence<n>) {
-            auto new_state = f(state, hana::at_c<n>(static_cast<Xs&&>(xs)));
-            return hana::make<S>(static_cast<State&&>(state), std::move(new_state));
+        // Without initial state
+        template <typename Xs, typename F>
+        static constexpr auto apply1_impl(Xs&&, F const&, std::integral_constant<std::size_t, 0>)
+        { return hana::empty<S>(); }
+
+        template <typename Xs, typename F, std::size_t n>
+        static constexpr auto apply1_impl(Xs&& xs, F const& f, std::integral_constant<std::size_t, n>) {
+            // Use scan_left with the first element as an initial state.
+            return scan_left_impl::scan<1, n>(static_cast<Xs&&>(xs),
+                                              hana::at_c<0>(static_cast<Xs&&>(xs)), f);
         }
 
-        template <typename Xs, typename State, typename F>
-        static constexpr auto
-        apply_impl(Xs&&, State&& state, F const&, std::index_sequence<>) {
-            return hana::make<S>(static_cast<State&&>(state));
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F const& f) {
+            constexpr std::size_t Len = decltype(hana::length(xs))::value;
+            return scan_left_impl::apply1_impl(static_cast<Xs&&>(xs), f,
+                                               std::integral_constant<std::size_t, Len>{});
         }
 
+
+        // With initial state
         template <typename Xs, typename State, typename F>
         static constexpr auto apply(Xs&& xs, State&& state, F const& f) {
             constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            return scan_left_impl::apply_impl(static_cast<Xs&&>(xs),
-                                              static_cast<State&&>(state),
-                                              f, std::make_index_sequence<Len>{});
+            return scan_left_impl::scan<0, Len>(static_cast<Xs&&>(xs),
+                                                static_cast<State&&>(state), f);
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -13,14 +13,18 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/scan_right.hpp>
 
 #include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/scan.hpp>
+#include <boost/hana/detail/unpack_flatten.hpp>
 #include <boost/hana/empty.hpp>
-#include <boost/hana/front.hpp>
 #include <boost/hana/length.hpp>
-#include <boost/hana/prepend.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -62,67 +66,118 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <typename S, bool condition>
     struct scan_right_impl<S, when<condition>> : default_ {
-        // Without initial state
-        template <typename Xs, typename F, std::size_t n1, std::size_t n2, std::size_t ...ns>
+        // Like for `scan_left`, the states are computed in steps of 4
+        // elements, starting from the right, and the states computed by
+        // each step are put into the resulting sequence all at once.
+        // `i` is the index of the state `s0`, which is the state computed
+        // last; the states at indices `[0, i)` remain to be computed.
+        template <std::size_t i, typename Xs, typename State,
+                  typename F, typename ...Steps>
         static constexpr auto
-        apply1_impl(Xs&& xs, F const& f, std::index_sequence<n1, n2, ns...>) {
-            auto rest = scan_right_impl::apply1_impl(static_cast<Xs&&>(xs),
-                                                     f, std::index_sequence<n2, ns...>{});
-            auto element = f(hana::at_c<n1>(static_cast<Xs&&>(xs)), hana::front(rest));
-            return hana::prepend(std::move(rest), std::move(element));
+        scan_steps(Xs&& xs, State&& s0, F const& f, std::integral_constant<std::size_t, 4>, Steps&& ...steps) {
+            auto s1 = f(hana::at_c<i - 1>(static_cast<Xs&&>(xs)), s0);
+            auto s2 = f(hana::at_c<i - 2>(static_cast<Xs&&>(xs)), s1);
+            auto s3 = f(hana::at_c<i - 3>(static_cast<Xs&&>(xs)), s2);
+            auto s4 = f(hana::at_c<i - 4>(static_cast<Xs&&>(xs)), s3);
+            return scan_right_impl::scan_steps<i - 4>(
+                static_cast<Xs&&>(xs), std::move(s4), f, detail::scan_step<i - 4>{},
+                hana::make_basic_tuple(std::move(s3), std::move(s2),
+                                       std::move(s1), static_cast<State&&>(s0)),
+                static_cast<Steps&&>(steps)...
+            );
         }
 
-        template <typename Xs, typename F, std::size_t n>
-        static constexpr auto apply1_impl(Xs&& xs, F const&, std::index_sequence<n>) {
-            return hana::make<S>(hana::at_c<n>(static_cast<Xs&&>(xs)));
+        template <std::size_t i, typename Xs, typename State,
+                  typename F, typename ...Steps>
+        static constexpr auto
+        scan_steps(Xs&& xs, State&& s0, F const& f, std::integral_constant<std::size_t, 1>, Steps&& ...steps) {
+            auto s1 = f(hana::at_c<i - 1>(static_cast<Xs&&>(xs)), s0);
+            return scan_right_impl::scan_steps<i - 1>(
+                static_cast<Xs&&>(xs), std::move(s1), f, detail::scan_step<i - 1>{},
+                hana::make_basic_tuple(static_cast<State&&>(s0)),
+                static_cast<Steps&&>(steps)...
+            );
         }
 
-        template <typename Xs, typename F>
-        static constexpr auto apply1_impl(Xs&&, F const&, std::index_sequence<>) {
-            return hana::empty<S>();
+        template <std::size_t i, typename Xs, typename State,
+                  typename F, typename ...Steps>
+        static constexpr auto
+        scan_steps(Xs&&, State&& s0, F const&, std::integral_constant<std::size_t, 0>, Steps&& ...steps) {
+            return detail::unpack_flatten(
+                hana::make_basic_tuple(hana::make_basic_tuple(static_cast<State&&>(s0)),
+                                       static_cast<Steps&&>(steps)...),
+                hana::make<S>
+            );
         }
 
-        template <typename Xs, typename F>
-        static constexpr auto apply(Xs&& xs, F const& f) {
-            constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            return scan_right_impl::apply1_impl(static_cast<Xs&&>(xs),
-                                                f, std::make_index_sequence<Len>{});
+        // When all the states have the same type, they are computed without
+        // recursion into an array, in the order of its initializers. The
+        // array holds the states from right to left.
+        template <typename Xs, typename State, typename F, std::size_t ...i>
+        static constexpr auto
+        scan_homogeneous(Xs&& xs, State&& state, F const& f, std::index_sequence<i...>) {
+            constexpr std::size_t n = sizeof...(i);
+            using T = typename detail::decay<State>::type;
+            T s = state;
+            detail::array<T, n + 1> states{{
+                static_cast<State&&>(state),
+                (s = f(hana::at_c<n - 1 - i>(static_cast<Xs&&>(xs)), s))...
+            }};
+            return hana::make<S>(std::move(states[n - i])..., std::move(states[0]));
         }
 
+        template <std::size_t n, typename Xs, typename State, typename F>
+        static constexpr auto scan_impl(Xs&& xs, State&& state, F const& f, hana::true_) {
+            return scan_right_impl::scan_homogeneous(
+                static_cast<Xs&&>(xs), static_cast<State&&>(state), f,
+                std::make_index_sequence<n>{});
+        }
 
-        // With initial state
-        template <typename Xs, typename State, typename F,
-                  std::size_t n1, std::size_t n2, std::size_t ...ns>
-        static constexpr auto
-        apply_impl(Xs&& xs, State&& state, F const& f,
-                   std::index_sequence<n1, n2, ns...>)
-        {
-            auto rest = scan_right_impl::apply_impl(static_cast<Xs&&>(xs),
-                                                    static_cast<State&&>(state),
-                                                    f, std::index_sequence<n2, ns...>{});
-            auto element = f(hana::at_c<n1>(static_cast<Xs&&>(xs)), hana::front(rest));
-            return hana::prepend(std::move(rest), std::move(element));
+        template <std::size_t n, typename Xs, typename State, typename F>
+        static constexpr auto scan_impl(Xs&& xs, State&& state, F const& f, hana::false_) {
+            return scan_right_impl::scan_steps<n>(
+                static_cast<Xs&&>(xs), static_cast<State&&>(state), f,
+                detail::scan_step<n>{});
         }
 
-        template <typename Xs, typename State, typename F, std::size_t n>
-        static constexpr auto
-        apply_impl(Xs&& xs, State&& state, F const& f, std::index_sequence<n>) {
-            auto element = f(hana::at_c<n>(static_cast<Xs&&>(xs)), state);
-            return hana::make<S>(std::move(element), static_cast<State&&>(state));
+        // Scans the elements at indices `[0, n)`, starting with `state`.
+        template <std::size_t n, typename Xs, typename State, typename F>
+        static constexpr auto scan(Xs&& xs, State&& state, F const& f) {
+            using Homogeneous = detail::homogeneous_scan<
+                false, Xs&&, typename detail::decay<State>::type, F, 0,
+                std::make_index_sequence<n>
+            >;
+            return scan_right_impl::scan_impl<n>(
+                static_cast<Xs&&>(xs), static_cast<State&&>(state), f,
+                hana::bool_c<Homogeneous::value>);
         }
 
-        template <typename Xs, typename State, typename F>
-        static constexpr auto
-        apply_impl(Xs&&, State&& state, F const&, std::index_sequence<>) {
-            return hana::make<S>(static_cast<State&&>(state));
+        // Without initial state
+        template <typename Xs, typename F>
+        static constexpr auto apply1_impl(Xs&&, F const&, std::integral_constant<std::size_t, 0>)
+        { return hana::empty<S>(); }
+
+        template <typename Xs, typename F, std::size_t n>
+        static constexpr auto apply1_impl(Xs&& xs, F const& f, std::integral_constant<std::size_t, n>) {
+            // Use scan_right with the last element as an initial state.
+            return scan_right_impl::scan<n - 1>(static_cast<Xs&&>(xs),
+                                                hana::at_c<n - 1>(static_cast<Xs&&>(xs)), f);
         }
 
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F const& f) {
+            constexpr std::size_t Len = decltype(hana::length(xs))::value;
+            return scan_right_impl::apply1_impl(static_cast<Xs&&>(xs), f,
+                                                std::integral_constant<std::size_t, Len>{});
+        }
+
+
+        // With initial state
         template <typename Xs, typename State, typename F>
         static constexpr auto apply(Xs&& xs, State&& state, F const& f) {
             constexpr std::size_t Len = decltype(hana::length(xs))::value;
-            return scan_right_impl::apply_impl(static_cast<Xs&&>(xs),
-                                               static_cast<State&&>(state),
-                                               f, std::make_index_sequence<Len>{});
+            return scan_right_impl::scan<Len>(static_cast<Xs&&>(xs),
+                                              static_cast<State&&>(state), f);
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -12,7 +12,9 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/set.hpp>
 
+#include <boost/hana/append.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/concept/comparable.hpp>
 #include <boost/hana/concept/constant.hpp>
@@ -23,7 +25,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/to.hpp>
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
 #include <boost/hana/detail/has_duplicates.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/searchable.hpp>
@@ -32,18 +36,19 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/find_if.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/fwd/any_of.hpp>
+#include <boost/hana/fwd/at_key.hpp>
 #include <boost/hana/fwd/core/to.hpp>
 #include <boost/hana/fwd/difference.hpp>
+#include <boost/hana/fwd/find.hpp>
 #include <boost/hana/fwd/intersection.hpp>
 #include <boost/hana/fwd/union.hpp>
 #include <boost/hana/insert.hpp>
 #include <boost/hana/is_subset.hpp>
 #include <boost/hana/length.hpp>
+#include <boost/hana/optional.hpp>
 #include <boost/hana/or.hpp>
-#include <boost/hana/remove.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/unpack.hpp>
-#include <boost/hana/value.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -55,21 +60,24 @@ BOOST_HANA_NAMESPACE_BEGIN
     // set
     //////////////////////////////////////////////////////////////////////////
     //! @cond
-    template <typename ...Xs>
+    template <typename HashTable, typename Storage>
     struct set
-        : detail::operators::adl<set<Xs...>>
-        , detail::searchable_operators<set<Xs...>>
+        : detail::operators::adl<set<HashTable, Storage>>
+        , detail::searchable_operators<set<HashTable, Storage>>
     {
-        tuple<Xs...> storage;
+        using hash_table_type = HashTable;
+        using storage_type = Storage;
+
+        Storage storage;
+
         using hana_tag = set_tag;
-        static constexpr std::size_t size = sizeof...(Xs);
 
-        explicit constexpr set(tuple<Xs...> const& xs)
+        explicit constexpr set(Storage const& xs)
             : storage(xs)
         { }
 
-        explicit constexpr set(tuple<Xs...>&& xs)
-            : storage(static_cast<tuple<Xs...>&&>(xs))
+        explicit constexpr set(Storage&& xs)
+            : storage(static_cast<Storage&&>(xs))
         { }
 
         constexpr set(set const& other) = default;
@@ -77,6 +85,58 @@ BOOST_HANA_NAMESPACE_BEGIN
     };
     //! @endcond
 
+    namespace detail {
+        template <typename Storage>
+        struct ElementAtIndex {
+            template <std::size_t i>
+            using apply = decltype(hana::get_impl<i>(std::declval<Storage>()));
+        };
+
+        // Returns the index of the element equal to `Key` in the set, as
+        // an `optional<std::integral_constant<std::size_t, i>>`, or
+        // `optional<>` if there is no such element.
+        template <typename Set, typename Key>
+        struct set_find_index {
+            using type = typename detail::find_index<
+                typename Set::hash_table_type, Key,
+                ElementAtIndex<typename Set::storage_type>::template apply
+            >::type;
+        };
+
+        template <typename Set, typename Key>
+        struct set_contains
+            : std::integral_constant<bool,
+                !std::is_same<typename set_find_index<Set, Key>::type,
+                              hana::optional<>>::value
+            >
+        { };
+
+        // Creates a set from elements that are known to be unique, which
+        // bypasses the checks performed by `make_set`.
+        struct make_unique_set {
+            template <typename ...Xs>
+            constexpr auto operator()(Xs&& ...xs) const {
+                using Storage = hana::basic_tuple<typename detail::decay<Xs>::type...>;
+                using HashTable = typename detail::make_collision_safe_hash_table<
+                    ElementAtIndex<Storage>::template apply, sizeof...(Xs)
+                >::type;
+                return hana::set<HashTable, Storage>(
+                    hana::make_basic_tuple(static_cast<Xs&&>(xs)...)
+                );
+            }
+        };
+
+        struct set_has_duplicates {
+            template <typename ...Xs>
+            constexpr auto operator()(Xs const& ...) const {
+                using Storage = hana::basic_tuple<typename detail::decay<Xs>::type...>;
+                return hana::bool_c<detail::has_duplicate_keys<
+                    ElementAtIndex<Storage>::template apply, sizeof...(Xs)
+                >::value>;
+            }
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Operators
     //////////////////////////////////////////////////////////////////////////
@@ -111,9 +171,7 @@ BOOST_HANA_NAMESPACE_BEGIN
             "hana::make_set(xs...) requires all the 'xs' to be unique");
 #endif
 
-            return set<typename detail::decay<Xs>::type...>{
-                hana::make_tuple(static_cast<Xs&&>(xs)...)
-            };
+            return detail::make_unique_set{}(static_cast<Xs&&>(xs)...);
         }
     };
 
@@ -182,22 +240,63 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct find_impl<set_tag> {
+        template <typename Set>
+        static constexpr auto find_helper(Set&&, ...) {
+            return hana::nothing;
+        }
+
+        template <typename Set, std::size_t i>
+        static constexpr auto
+        find_helper(Set&& set, hana::optional<std::integral_constant<std::size_t, i>>) {
+            return hana::just(hana::at_c<i>(static_cast<Set&&>(set).storage));
+        }
+
+        template <typename Set, typename Key>
+        static constexpr auto apply(Set&& set, Key const&) {
+            using RawSet = typename std::remove_reference<Set>::type;
+            using MaybeIndex = typename detail::set_find_index<RawSet, Key>::type;
+            return find_helper(static_cast<Set&&>(set), MaybeIndex{});
+        }
+    };
+
+    template <>
+    struct contains_impl<set_tag> {
+        template <typename Set, typename Key>
+        static constexpr auto apply(Set const&, Key const&) {
+            return hana::bool_c<detail::set_contains<Set, Key>::value>;
+        }
+    };
+
+    template <>
+    struct at_key_impl<set_tag> {
+        template <typename Set, typename Key>
+        static constexpr decltype(auto) apply(Set&& set, Key const&) {
+            using RawSet = typename std::remove_reference<Set>::type;
+            using MaybeIndex = typename detail::set_find_index<RawSet, Key>::type;
+            static_assert(!decltype(hana::is_nothing(MaybeIndex{}))::value,
+                "hana::at_key(set, key) requires the 'key' to be present in the 'set'");
+            constexpr std::size_t index = decltype(*MaybeIndex{}){}();
+            return hana::at_c<index>(static_cast<Set&&>(set).storage);
+        }
+    };
+
     template <>
     struct is_subset_impl<set_tag, set_tag> {
         template <typename Ys>
         struct all_contained {
-            Ys const& ys;
             template <typename ...X>
-            constexpr auto operator()(X const& ...x) const {
+            constexpr auto operator()(X const& ...) const {
                 return hana::bool_c<detail::fast_and<
-                    hana::value<decltype(hana::contains(ys, x))>()...
+                    detail::set_contains<Ys, X>::value...
                 >::value>;
             }
         };
 
         template <typename Xs, typename Ys>
-        static constexpr auto apply(Xs const& xs, Ys const& ys) {
-            return hana::unpack(xs, all_contained<Ys>{ys});
+        static constexpr auto apply(Xs const& xs, Ys const&) {
+            return hana::unpack(xs, all_contained<Ys>{});
         }
     };
 
@@ -207,11 +306,27 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename F>
     struct to_impl<set_tag, F, when<hana::Foldable<F>::value>> {
         template <typename Xs>
-        static constexpr decltype(auto) apply(Xs&& xs) {
+        static constexpr decltype(auto) helper(Xs&& xs, hana::true_) {
             return hana::fold_left(static_cast<Xs&&>(xs),
                                    hana::make_set(),
                                    hana::insert);
         }
+
+        template <typename Xs>
+        static constexpr auto helper(Xs&& xs, hana::false_) {
+            return hana::unpack(static_cast<Xs&&>(xs), detail::make_unique_set{});
+        }
+
+        // When there are no duplicates, which can be checked by only
+        // comparing elements whose hashes collide, the set is created in
+        // one shot instead of inserting the elements one by one.
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using HasDuplicates = decltype(
+                hana::unpack(xs, detail::set_has_duplicates{})
+            );
+            return helper(static_cast<Xs&&>(xs), HasDuplicates{});
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -219,26 +334,36 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct insert_impl<set_tag> {
-        template <typename Xs, typename X, typename Indices>
-        static constexpr auto
-        insert_helper(Xs&& xs, X&&, hana::true_, Indices) {
-            return static_cast<Xs&&>(xs);
+        template <typename Set, typename X, typename NewHashTable>
+        static constexpr auto helper(Set&& set, X&& x, NewHashTable, hana::optional<>) {
+            using NewStorage = decltype(
+                hana::append(static_cast<Set&&>(set).storage, static_cast<X&&>(x))
+            );
+            return hana::set<NewHashTable, NewStorage>(
+                hana::append(static_cast<Set&&>(set).storage, static_cast<X&&>(x))
+            );
         }
 
-        template <typename Xs, typename X, std::size_t ...n>
+        template <typename Set, typename X, typename NewHashTable, std::size_t i>
         static constexpr auto
-        insert_helper(Xs&& xs, X&& x, hana::false_, std::index_sequence<n...>) {
-            return hana::make_set(
-                hana::at_c<n>(static_cast<Xs&&>(xs).storage)..., static_cast<X&&>(x)
-            );
+        helper(Set&& set, X&&, NewHashTable,
+               hana::optional<std::integral_constant<std::size_t, i>>)
+        {
+            return static_cast<Set&&>(set);
         }
 
-        template <typename Xs, typename X>
-        static constexpr auto apply(Xs&& xs, X&& x) {
-            constexpr bool c = hana::value<decltype(hana::contains(xs, x))>();
-            constexpr std::size_t size = std::remove_reference<Xs>::type::size;
-            return insert_helper(static_cast<Xs&&>(xs), static_cast<X&&>(x),
-                                 hana::bool_c<c>, std::make_index_sequence<size>{});
+        template <typename Set, typename X>
+        static constexpr auto apply(Set&& set, X&& x) {
+            using RawSet = typename std::remove_reference<Set>::type;
+            using Storage = typename RawSet::storage_type;
+            using Insert = detail::bucket_insert<
+                typename RawSet::hash_table_type,
+                X,
+                decltype(hana::length(set.storage))::value,
+                detail::ElementAtIndex<Storage>::template apply
+            >;
+            return helper(static_cast<Set&&>(set), static_cast<X&&>(x),
+                          typename Insert::type{}, typename Insert::found{});
         }
     };
 
@@ -247,40 +372,86 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<set_tag> {
-        template <typename Xs, typename X>
-        static constexpr decltype(auto) apply(Xs&& xs, X&& x) {
-            return hana::unpack(
-                hana::remove(static_cast<Xs&&>(xs).storage,
-                             static_cast<X&&>(x)),
-                hana::make_set
-            );
+        template <typename Set, typename X>
+        static constexpr auto helper(Set&& set, X const&, ...) {
+            return static_cast<Set&&>(set);
+        }
+
+        template <typename NewHashTable, typename Set, std::size_t ...before, std::size_t ...after>
+        static constexpr auto
+        erase_helper(Set&& set, std::index_sequence<before...>,
+                                std::index_sequence<after...>)
+        {
+            using NewStorage = decltype(hana::make_basic_tuple(
+                hana::at_c<before>(static_cast<Set&&>(set).storage)...,
+                hana::at_c<after + sizeof...(before) + 1>(static_cast<Set&&>(set).storage)...
+            ));
+            return hana::set<NewHashTable, NewStorage>(hana::make_basic_tuple(
+                hana::at_c<before>(static_cast<Set&&>(set).storage)...,
+                hana::at_c<after + sizeof...(before) + 1>(static_cast<Set&&>(set).storage)...
+            ));
+        }
+
+        template <typename Set, typename X, std::size_t i>
+        static constexpr auto
+        helper(Set&& set, X const&, hana::optional<std::integral_constant<std::size_t, i>>) {
+            using RawSet = typename std::remove_reference<Set>::type;
+            using NewHashTable = typename detail::bucket_erase<
+                typename RawSet::hash_table_type, X, i
+            >::type;
+            constexpr std::size_t size = decltype(hana::length(set.storage))::value;
+            return erase_helper<NewHashTable>(static_cast<Set&&>(set),
+                                              std::make_index_sequence<i>{},
+                                              std::make_index_sequence<size - i - 1>{});
+        }
+
+        template <typename Set, typename X>
+        static constexpr auto apply(Set&& set, X const& x) {
+            using RawSet = typename std::remove_reference<Set>::type;
+            using MaybeIndex = typename detail::set_find_index<RawSet, X>::type;
+            return helper(static_cast<Set&&>(set), x, MaybeIndex{});
         }
     };
 
     //////////////////////////////////////////////////////////////////////////
-    // intersection
+    // intersection, union_ and difference
+    //
+    // These are implemented by looking up each element of the first set in
+    // the hash table of the second one, and then creating the resulting set
+    // with a single pack expansion.
     //////////////////////////////////////////////////////////////////////////
     namespace detail {
-        template <typename Ys>
-        struct set_insert_if_contains {
-            Ys const& ys;
-
-            template <typename Result, typename Key>
-            static constexpr auto helper(Result&& result, Key&& key, hana::true_) {
-                return hana::insert(static_cast<Result&&>(result), static_cast<Key&&>(key));
-            }
+        // Indices of the elements of `Xs` whose membership in `Ys` is `Keep`.
+        template <typename Xs, typename Ys, bool Keep,
+                  typename Storage = typename Xs::storage_type>
+        struct set_membership_indices;
+
+        template <typename Xs, typename Ys, bool Keep, typename ...X>
+        struct set_membership_indices<Xs, Ys, Keep, hana::basic_tuple<X...>> {
+            using type = detail::filter_indices<
+                (detail::set_contains<Ys, X>::value == Keep)...
+            >;
+        };
 
-            template <typename Result, typename Key>
-            static constexpr auto helper(Result&& result, Key&&, hana::false_) {
-                return static_cast<Result&&>(result);
+        template <typename Xs, typename Ys, bool Keep>
+        struct set_filter_by_membership {
+            template <typename Indices, typename Set, std::size_t ...i, typename ...Prefix>
+            static constexpr auto
+            helper(Set&& xs, std::index_sequence<i...>, Prefix&& ...prefix) {
+                return detail::make_unique_set{}(
+                    static_cast<Prefix&&>(prefix)...,
+                    hana::at_c<Indices::indices[i]>(static_cast<Set&&>(xs).storage)...
+                );
             }
 
-            template <typename Result, typename Key>
-            constexpr auto operator()(Result&& result, Key&& key) const {
-                constexpr bool keep = hana::value<decltype(hana::contains(ys, key))>();
-                return set_insert_if_contains::helper(static_cast<Result&&>(result),
-                                                      static_cast<Key&&>(key),
-                                                      hana::bool_c<keep>);
+            // Returns a set containing `prefix...` followed by the elements
+            // of `xs` whose membership in `Ys` is `Keep`.
+            template <typename Set, typename ...Prefix>
+            static constexpr auto apply(Set&& xs, Prefix&& ...prefix) {
+                using Indices = typename set_membership_indices<Xs, Ys, Keep>::type;
+                return helper<Indices>(static_cast<Set&&>(xs),
+                    std::make_index_sequence<Indices::indices.size()>{},
+                    static_cast<Prefix&&>(prefix)...);
             }
         };
     }
@@ -288,33 +459,42 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <>
     struct intersection_impl<set_tag> {
         template <typename Xs, typename Ys>
-        static constexpr auto apply(Xs&& xs, Ys const& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), hana::make_set(),
-                                   detail::set_insert_if_contains<Ys>{ys});
+        static constexpr auto apply(Xs&& xs, Ys const&) {
+            using RawXs = typename std::remove_reference<Xs>::type;
+            return detail::set_filter_by_membership<RawXs, Ys, true>::apply(
+                static_cast<Xs&&>(xs)
+            );
         }
     };
 
-    //////////////////////////////////////////////////////////////////////////
-    // union_
-    //////////////////////////////////////////////////////////////////////////
     template <>
     struct union_impl<set_tag> {
+        template <typename Xs, typename Ys, std::size_t ...i>
+        static constexpr auto union_helper(Xs&& xs, Ys&& ys, std::index_sequence<i...>) {
+            using RawXs = typename std::remove_reference<Xs>::type;
+            using RawYs = typename std::remove_reference<Ys>::type;
+            return detail::set_filter_by_membership<RawXs, RawYs, false>::apply(
+                static_cast<Xs&&>(xs),
+                hana::at_c<i>(static_cast<Ys&&>(ys).storage)...
+            );
+        }
+
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
-                                   hana::insert);
+            constexpr std::size_t size = decltype(hana::length(ys.storage))::value;
+            return union_helper(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
+                                std::make_index_sequence<size>{});
         }
     };
 
-    //////////////////////////////////////////////////////////////////////////
-    // difference
-    //////////////////////////////////////////////////////////////////////////
     template <>
     struct difference_impl<set_tag> {
         template <typename Xs, typename Ys>
-        static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Ys&&>(ys), static_cast<Xs&&>(xs),
-                                   hana::erase_key);
+        static constexpr auto apply(Xs&& xs, Ys const&) {
+            using RawXs = typename std::remove_reference<Xs>::type;
+            return detail::set_filter_by_membership<RawXs, Ys, false>::apply(
+                static_cast<Xs&&>(xs)
+            );
         }
     };
 BOOST_HANA_NAMESPACE_END
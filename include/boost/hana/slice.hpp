@@ -31,12 +31,12 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto slice_t::operator()(Xs&& xs, Indices&& indices) const {
         using S = typename hana::tag_of<Xs>::type;
         using Slice = BOOST_HANA_DISPATCH_IF(slice_impl<S>,
-            hana::Sequence<S>::value &&
+            (hana::Sequence<S>::value || !is_default<slice_impl<S>>::value) &&
             hana::Foldable<Indices>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(hana::Sequence<S>::value || !is_default<slice_impl<S>>::value,
         "hana::slice(xs, indices) requires 'xs' to be a Sequence");
 
         static_assert(hana::Foldable<Indices>::value,
@@ -17,9 +17,12 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/merge_sort.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
+#include <boost/hana/detail/type_at.hpp>
 #include <boost/hana/length.hpp>
 #include <boost/hana/less.hpp>
+#include <boost/hana/unpack.hpp>
 
 #include <utility> // std::declval, std::index_sequence
 
@@ -30,11 +33,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto sort_t::operator()(Xs&& xs, Predicate&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using Sort = BOOST_HANA_DISPATCH_IF(sort_impl<S>,
-            hana::Sequence<S>::value
+            (hana::Sequence<S>::value || !is_default<sort_impl<S>>::value)
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(hana::Sequence<S>::value || !is_default<sort_impl<S>>::value,
         "hana::sort(xs, predicate) requires 'xs' to be a Sequence");
     #endif
 
@@ -46,11 +49,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto sort_t::operator()(Xs&& xs) const {
         using S = typename hana::tag_of<Xs>::type;
         using Sort = BOOST_HANA_DISPATCH_IF(sort_impl<S>,
-            hana::Sequence<S>::value
+            (hana::Sequence<S>::value || !is_default<sort_impl<S>>::value)
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(hana::Sequence<S>::value || !is_default<sort_impl<S>>::value,
         "hana::sort(xs) requires 'xs' to be a Sequence");
     #endif
 
@@ -59,91 +62,26 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @endcond
 
     namespace detail {
+        // sort_predicate:
+        //  The types of the elements are collected once into a `type_pack`,
+        //  so that each comparison only needs a constant-time type lookup
+        //  instead of going through `at_c` on the sequence itself.
+        struct collect_types {
+            template <typename ...X>
+            auto operator()(X&& ...) const -> detail::type_pack<X&&...>;
+        };
+
         template <typename Xs, typename Pred>
         struct sort_predicate {
+            using Elements = decltype(hana::unpack(std::declval<Xs>(),
+                                                   collect_types{}));
+
             template <std::size_t I, std::size_t J>
             using apply = decltype(std::declval<Pred>()(
-                hana::at_c<I>(std::declval<Xs>()),
-                hana::at_c<J>(std::declval<Xs>())
+                std::declval<typename Elements::template at<I>>(),
+                std::declval<typename Elements::template at<J>>()
             ));
         };
-
-        template <typename Pred, std::size_t Insert, bool IsInsertionPoint,
-                  typename Left,
-                  std::size_t ...Right>
-        struct insert;
-
-        // We did not find the insertion point; continue processing elements
-        // recursively.
-        template <
-            typename Pred, std::size_t Insert,
-            std::size_t ...Left,
-            std::size_t Right1, std::size_t Right2, std::size_t ...Right
-        >
-        struct insert<Pred, Insert, false,
-                      std::index_sequence<Left...>,
-                      Right1, Right2, Right...
-        > {
-            using type = typename insert<
-                Pred, Insert, (bool)Pred::template apply<Insert, Right2>::value,
-                std::index_sequence<Left..., Right1>,
-                Right2, Right...
-            >::type;
-        };
-
-        // We did not find the insertion point, but there is only one element
-        // left. We insert at the end of the list, and we're done.
-        template <typename Pred, std::size_t Insert, std::size_t ...Left, std::size_t Last>
-        struct insert<Pred, Insert, false, std::index_sequence<Left...>, Last> {
-            using type = std::index_sequence<Left..., Last, Insert>;
-        };
-
-        // We found the insertion point, we're done.
-        template <typename Pred, std::size_t Insert, std::size_t ...Left, std::size_t ...Right>
-        struct insert<Pred, Insert, true, std::index_sequence<Left...>, Right...> {
-            using type = std::index_sequence<Left..., Insert, Right...>;
-        };
-
-
-        template <typename Pred, typename Result, std::size_t ...T>
-        struct insertion_sort_impl;
-
-        template <typename Pred,
-                  std::size_t Result1, std::size_t ...Result,
-                  std::size_t T, std::size_t ...Ts>
-        struct insertion_sort_impl<Pred, std::index_sequence<Result1, Result...>, T, Ts...> {
-            using type = typename insertion_sort_impl<
-                Pred,
-                typename insert<
-                    Pred, T, (bool)Pred::template apply<T, Result1>::value,
-                    std::index_sequence<>,
-                    Result1, Result...
-                >::type,
-                Ts...
-            >::type;
-        };
-
-        template <typename Pred, std::size_t T, std::size_t ...Ts>
-        struct insertion_sort_impl<Pred, std::index_sequence<>, T, Ts...> {
-            using type = typename insertion_sort_impl<
-                Pred, std::index_sequence<T>, Ts...
-            >::type;
-        };
-
-        template <typename Pred, typename Result>
-        struct insertion_sort_impl<Pred, Result> {
-            using type = Result;
-        };
-
-        template <typename Pred, typename Indices>
-        struct sort_helper;
-
-        template <typename Pred, std::size_t ...i>
-        struct sort_helper<Pred, std::index_sequence<i...>> {
-            using type = typename insertion_sort_impl<
-                Pred, std::index_sequence<>, i...
-            >::type;
-        };
     } // end namespace detail
 
     template <typename S, bool condition>
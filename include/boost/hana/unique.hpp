@@ -15,11 +15,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/filter_indices.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
 #include <boost/hana/equal.hpp>
-#include <boost/hana/front.hpp>
 #include <boost/hana/group.hpp>
-#include <boost/hana/transform.hpp>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -28,11 +27,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto unique_t::operator()(Xs&& xs) const {
         using S = typename hana::tag_of<Xs>::type;
         using Unique = BOOST_HANA_DISPATCH_IF(unique_impl<S>,
-            hana::Sequence<S>::value
+            (hana::Sequence<S>::value || !is_default<unique_impl<S>>::value)
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert((hana::Sequence<S>::value || !is_default<unique_impl<S>>::value),
         "hana::unique(xs) requires 'xs' to be a Sequence");
     #endif
 
@@ -43,11 +42,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto unique_t::operator()(Xs&& xs, Predicate&& predicate) const {
         using S = typename hana::tag_of<Xs>::type;
         using Unique = BOOST_HANA_DISPATCH_IF(unique_impl<S>,
-            hana::Sequence<S>::value
+            (hana::Sequence<S>::value || !is_default<unique_impl<S>>::value)
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert((hana::Sequence<S>::value || !is_default<unique_impl<S>>::value),
         "hana::unique(xs, predicate) requires 'xs' to be a Sequence");
     #endif
 
@@ -59,11 +58,9 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename S, bool condition>
     struct unique_impl<S, when<condition>> : default_ {
         template <typename Xs, typename Pred>
-        static constexpr auto apply(Xs&& xs, Pred&& pred) {
-            return hana::transform(
-                hana::group(static_cast<Xs&&>(xs), static_cast<Pred&&>(pred)),
-                hana::front
-            );
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            using Starts = detail::group_starts_t<Xs&&, Pred>;
+            return detail::make_from_indices<S, Starts>(static_cast<Xs&&>(xs));
         }
 
         template <typename Xs>
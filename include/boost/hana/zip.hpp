@@ -24,14 +24,16 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
     template <typename Xs, typename ...Ys>
     constexpr auto zip_t::operator()(Xs&& xs, Ys&& ...ys) const {
+        using S = typename hana::tag_of<Xs>::type;
+
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(detail::fast_and<
+        static_assert(!is_default<zip_impl<S>>::value || detail::fast_and<
             hana::Sequence<Xs>::value, hana::Sequence<Ys>::value...
         >::value,
         "hana::zip(xs, ys...) requires 'xs' and 'ys...' to be Sequences");
     #endif
 
-        return zip_impl<typename hana::tag_of<Xs>::type>::apply(
+        return zip_impl<S>::apply(
             static_cast<Xs&&>(xs),
             static_cast<Ys&&>(ys)...
         );
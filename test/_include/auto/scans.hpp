@@ -106,6 +106,43 @@ TestCase test_scan_left{[]{
             f(f(f(f(f(s, ct_eq<0>{}), ct_eq<1>{}), ct_eq<2>{}), ct_eq<3>{}), ct_eq<4>{})
         )
     ));
+
+    // Longer sequences, which are handled in several steps
+    {
+        auto s0 = f(s, ct_eq<0>{}); auto s1 = f(s0, ct_eq<1>{});
+        auto s2 = f(s1, ct_eq<2>{}); auto s3 = f(s2, ct_eq<3>{});
+        auto s4 = f(s3, ct_eq<4>{}); auto s5 = f(s4, ct_eq<5>{});
+        auto s6 = f(s5, ct_eq<6>{}); auto s7 = f(s6, ct_eq<7>{});
+        auto s8 = f(s7, ct_eq<8>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::scan_left(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                                       ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{}, ct_eq<7>{},
+                                       ct_eq<8>{}), s, f),
+            MAKE_TUPLE(s, s0, s1, s2, s3, s4, s5, s6, s7, s8)
+        ));
+
+        auto t1 = f(ct_eq<0>{}, ct_eq<1>{}); auto t2 = f(t1, ct_eq<2>{});
+        auto t3 = f(t2, ct_eq<3>{}); auto t4 = f(t3, ct_eq<4>{});
+        auto t5 = f(t4, ct_eq<5>{}); auto t6 = f(t5, ct_eq<6>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::scan_left(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                                       ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{}), f),
+            MAKE_TUPLE(ct_eq<0>{}, t1, t2, t3, t4, t5, t6)
+        ));
+    }
+
+    // Runtime states of the same type
+    {
+        auto minus = [](int x, int y) { return x - y; };
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(
+            hana::scan_left(MAKE_TUPLE(1, 2, 3, 4, 5, 6), minus),
+            MAKE_TUPLE(1, -1, -4, -8, -13, -19)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(
+            hana::scan_left(MAKE_TUPLE(1, 2, 3, 4, 5, 6), 10, minus),
+            MAKE_TUPLE(10, 9, 7, 4, 0, -5, -11)
+        ));
+    }
 }};
 
 
@@ -211,6 +248,43 @@ TestCase test_scan_right{[]{
                                                                                   s
         )
     ));
+
+    // Longer sequences, which are handled in several steps
+    {
+        auto s8 = f(ct_eq<8>{}, s); auto s7 = f(ct_eq<7>{}, s8);
+        auto s6 = f(ct_eq<6>{}, s7); auto s5 = f(ct_eq<5>{}, s6);
+        auto s4 = f(ct_eq<4>{}, s5); auto s3 = f(ct_eq<3>{}, s4);
+        auto s2 = f(ct_eq<2>{}, s3); auto s1 = f(ct_eq<1>{}, s2);
+        auto s0 = f(ct_eq<0>{}, s1);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::scan_right(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                                        ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{}, ct_eq<7>{},
+                                        ct_eq<8>{}), s, f),
+            MAKE_TUPLE(s0, s1, s2, s3, s4, s5, s6, s7, s8, s)
+        ));
+
+        auto t5 = f(ct_eq<5>{}, ct_eq<6>{}); auto t4 = f(ct_eq<4>{}, t5);
+        auto t3 = f(ct_eq<3>{}, t4); auto t2 = f(ct_eq<2>{}, t3);
+        auto t1 = f(ct_eq<1>{}, t2); auto t0 = f(ct_eq<0>{}, t1);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::scan_right(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                                        ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{}), f),
+            MAKE_TUPLE(t0, t1, t2, t3, t4, t5, ct_eq<6>{})
+        ));
+    }
+
+    // Runtime states of the same type
+    {
+        auto minus = [](int x, int y) { return x - y; };
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(
+            hana::scan_right(MAKE_TUPLE(1, 2, 3, 4, 5, 6), minus),
+            MAKE_TUPLE(-3, 4, -2, 5, -1, 6)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(
+            hana::scan_right(MAKE_TUPLE(1, 2, 3, 4, 5, 6), 10, minus),
+            MAKE_TUPLE(7, -6, 8, -5, 9, -4, 10)
+        ));
+    }
 }};
 
 #endif // !BOOST_HANA_TEST_AUTO_SCANS_HPP
@@ -4,15 +4,60 @@
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/not.hpp>
 
 #include "minimal_struct.hpp"
 #include <laws/base.hpp>
+
+#include <cstring>
 namespace hana = boost::hana;
 using hana::test::ct_eq;
 
 
+// Compared with memcmp when possible
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Line {
+    BOOST_HANA_DEFINE_STRUCT(Line,
+        (Point, from),
+        (Point, to)
+    );
+};
+
+// Never compared with memcmp, because of the padding
+struct Padded {
+    BOOST_HANA_DEFINE_STRUCT(Padded,
+        (char, c),
+        (int, i)
+    );
+};
+
+// Never compared with memcmp, because of the custom equality
+struct Mod10 {
+    int value;
+    friend bool operator==(Mod10 a, Mod10 b) { ++comparisons; return a.value % 10 == b.value % 10; }
+    friend bool operator!=(Mod10 a, Mod10 b) { return !(a == b); }
+    static int comparisons;
+};
+int Mod10::comparisons = 0;
+
+struct Mod10s {
+    BOOST_HANA_DEFINE_STRUCT(Mod10s,
+        (Mod10, a),
+        (Mod10, b),
+        (Mod10, c)
+    );
+};
+
+constexpr bool constexpr_equal(Point p, Point q) { return hana::equal(p, q); }
+
 int main() {
     BOOST_HANA_CONSTANT_CHECK(hana::equal(
         obj(),
@@ -44,4 +89,37 @@ int main() {
         obj(ct_eq<99>{}, ct_eq<1>{}),
         obj(ct_eq<0>{}, ct_eq<1>{})
     )));
+
+    // runtime members
+    {
+        Point p{1, 2};
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(p, Point{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(!hana::equal(p, Point{1, 3}));
+        BOOST_HANA_RUNTIME_CHECK(!hana::equal(p, Point{0, 2}));
+
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(Line{{1, 2}, {3, 4}}, Line{{1, 2}, {3, 4}}));
+        BOOST_HANA_RUNTIME_CHECK(!hana::equal(Line{{1, 2}, {3, 4}}, Line{{1, 2}, {3, 5}}));
+
+        static_assert(constexpr_equal(Point{1, 2}, Point{1, 2}), "");
+        static_assert(!constexpr_equal(Point{1, 2}, Point{2, 1}), "");
+    }
+    {
+        Padded p1, p2;
+        std::memset(&p1, 0x00, sizeof(Padded));
+        std::memset(&p2, 0xff, sizeof(Padded));
+        p1.c = p2.c = 'x';
+        p1.i = p2.i = 3;
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(p1, p2));
+        p2.i = 4;
+        BOOST_HANA_RUNTIME_CHECK(!hana::equal(p1, p2));
+    }
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(Mod10s{{1}, {2}, {3}}, Mod10s{{11}, {22}, {33}}));
+        BOOST_HANA_RUNTIME_CHECK(Mod10::comparisons == 3);
+
+        // stop at the first pair of unequal members
+        Mod10::comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(!hana::equal(Mod10s{{1}, {2}, {3}}, Mod10s{{1}, {0}, {3}}));
+        BOOST_HANA_RUNTIME_CHECK(Mod10::comparisons == 2);
+    }
 }
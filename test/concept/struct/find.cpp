@@ -0,0 +1,97 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+
+#include "minimal_struct.hpp"
+#include <laws/base.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+// A key that is Comparable with the keys of the Struct, but not Hashable.
+struct non_hashable_key_tag;
+template <int i>
+struct non_hashable_key { using hana_tag = non_hashable_key_tag; };
+
+namespace boost { namespace hana {
+    template <>
+    struct equal_impl<non_hashable_key_tag, integral_constant_tag<int>> {
+        template <int i, typename K>
+        static constexpr auto apply(non_hashable_key<i> const&, K const&)
+        { return hana::bool_c<i == K::value>; }
+    };
+}}
+
+int main() {
+    // with keys given by the macros
+    {
+        Person john{"John", 30};
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::find(john, BOOST_HANA_STRING("name")) == hana::just(std::string{"John"})
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::find(john, BOOST_HANA_STRING("age")) == hana::just(30)
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find(john, BOOST_HANA_STRING("last_name")),
+            hana::nothing
+        ));
+    }
+
+    // with custom accessors
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find(obj(), hana::int_c<0>),
+            hana::nothing
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find(obj(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), hana::int_c<1>),
+            hana::just(ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find(obj(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), hana::int_c<3>),
+            hana::nothing
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_key(obj(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), hana::int_c<2>),
+            ct_eq<2>{}
+        ));
+
+        // keys that are equal, but of different types, have the same hash
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find(obj(ct_eq<0>{}, ct_eq<1>{}), hana::long_c<1>),
+            hana::just(ct_eq<1>{})
+        ));
+    }
+
+    // with a key that is not Hashable
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find(obj(ct_eq<0>{}, ct_eq<1>{}), non_hashable_key<1>{}),
+            hana::just(ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_key(obj(ct_eq<0>{}, ct_eq<1>{}), non_hashable_key<0>{}),
+            ct_eq<0>{}
+        ));
+    }
+}
@@ -0,0 +1,92 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concept/orderable.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/not.hpp>
+
+#include "minimal_struct.hpp"
+#include <laws/base.hpp>
+#include <string>
+namespace hana = boost::hana;
+using hana::test::ct_ord;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+struct Counted {
+    int value;
+    friend bool operator<(Counted a, Counted b) { ++comparisons; return a.value < b.value; }
+    static int comparisons;
+};
+int Counted::comparisons = 0;
+
+struct Counteds {
+    BOOST_HANA_DEFINE_STRUCT(Counteds,
+        (Counted, a),
+        (Counted, b),
+        (Counted, c)
+    );
+};
+
+static_assert(hana::Orderable<Person>::value, "");
+
+int main() {
+    // compile-time members
+    {
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::less(obj(), obj())));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::less(obj(ct_ord<0>{}), obj(ct_ord<1>{})));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::less(obj(ct_ord<0>{}), obj(ct_ord<0>{}))));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::less(obj(ct_ord<1>{}), obj(ct_ord<0>{}))));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::less(
+            obj(ct_ord<0>{}, ct_ord<9>{}),
+            obj(ct_ord<1>{}, ct_ord<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::less(
+            obj(ct_ord<0>{}, ct_ord<0>{}),
+            obj(ct_ord<0>{}, ct_ord<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::less(
+            obj(ct_ord<0>{}, ct_ord<1>{}),
+            obj(ct_ord<0>{}, ct_ord<1>{})
+        )));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::less(
+            obj(ct_ord<1>{}, ct_ord<0>{}),
+            obj(ct_ord<0>{}, ct_ord<9>{})
+        )));
+    }
+
+    // runtime members
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::less(Person{"Alice", 30}, Person{"Bob", 20}));
+        BOOST_HANA_RUNTIME_CHECK(hana::less(Person{"Bob", 20}, Person{"Bob", 30}));
+        BOOST_HANA_RUNTIME_CHECK(!hana::less(Person{"Bob", 30}, Person{"Bob", 30}));
+        BOOST_HANA_RUNTIME_CHECK(!hana::less(Person{"Bob", 30}, Person{"Bob", 20}));
+        BOOST_HANA_RUNTIME_CHECK(!hana::less(Person{"Bob", 20}, Person{"Alice", 30}));
+    }
+
+    // stop at the first pair of members that are not equivalent
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::less(Counteds{{0}, {5}, {5}}, Counteds{{1}, {0}, {0}}));
+        BOOST_HANA_RUNTIME_CHECK(Counted::comparisons == 1);
+
+        Counted::comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(!hana::less(Counteds{{1}, {5}, {5}}, Counteds{{0}, {0}, {0}}));
+        BOOST_HANA_RUNTIME_CHECK(Counted::comparisons == 2);
+
+        Counted::comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(hana::less(Counteds{{0}, {0}, {5}}, Counteds{{0}, {1}, {0}}));
+        BOOST_HANA_RUNTIME_CHECK(Counted::comparisons == 3);
+    }
+}
@@ -0,0 +1,164 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_adt.hpp>
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+// Make sure the macros work with more members than what used to be
+// supported (62), and with more members than a single chunk of the
+// underlying preprocessor loop.
+
+struct Defined {
+    BOOST_HANA_DEFINE_STRUCT(Defined,
+        (int, m0), (int, m1), (int, m2), (int, m3), (int, m4), (int, m5),
+        (int, m6), (int, m7), (int, m8), (int, m9), (int, m10), (int, m11),
+        (int, m12), (int, m13), (int, m14), (int, m15), (int, m16), (int, m17),
+        (int, m18), (int, m19), (int, m20), (int, m21), (int, m22), (int, m23),
+        (int, m24), (int, m25), (int, m26), (int, m27), (int, m28), (int, m29),
+        (int, m30), (int, m31), (int, m32), (int, m33), (int, m34), (int, m35),
+        (int, m36), (int, m37), (int, m38), (int, m39), (int, m40), (int, m41),
+        (int, m42), (int, m43), (int, m44), (int, m45), (int, m46), (int, m47),
+        (int, m48), (int, m49), (int, m50), (int, m51), (int, m52), (int, m53),
+        (int, m54), (int, m55), (int, m56), (int, m57), (int, m58), (int, m59),
+        (int, m60), (int, m61), (int, m62), (int, m63), (int, m64), (int, m65),
+        (int, m66), (int, m67), (int, m68), (int, m69)
+    );
+};
+
+namespace ns {
+    struct Adapted {
+        int m0; int m1; int m2; int m3; int m4; int m5; int m6; int m7; int m8; int m9;
+        int m10; int m11; int m12; int m13; int m14; int m15; int m16; int m17; int m18; int m19;
+        int m20; int m21; int m22; int m23; int m24; int m25; int m26; int m27; int m28; int m29;
+        int m30; int m31; int m32; int m33; int m34; int m35; int m36; int m37; int m38; int m39;
+        int m40; int m41; int m42; int m43; int m44; int m45; int m46; int m47; int m48; int m49;
+        int m50; int m51; int m52; int m53; int m54; int m55; int m56; int m57; int m58; int m59;
+        int m60; int m61; int m62; int m63; int m64; int m65; int m66; int m67; int m68; int m69;
+    };
+
+    struct AdaptedADT {
+        int m0; int m1; int m2; int m3; int m4; int m5; int m6; int m7; int m8; int m9;
+        int m10; int m11; int m12; int m13; int m14; int m15; int m16; int m17; int m18; int m19;
+        int m20; int m21; int m22; int m23; int m24; int m25; int m26; int m27; int m28; int m29;
+        int m30; int m31; int m32; int m33; int m34; int m35; int m36; int m37; int m38; int m39;
+        int m40; int m41; int m42; int m43; int m44; int m45; int m46; int m47; int m48; int m49;
+        int m50; int m51; int m52; int m53; int m54; int m55; int m56; int m57; int m58; int m59;
+        int m60; int m61; int m62; int m63; int m64; int m65; int m66; int m67; int m68; int m69;
+    };
+}
+
+BOOST_HANA_ADAPT_STRUCT(ns::Adapted,
+    m0, m1, m2, m3, m4, m5, m6, m7, m8, m9,
+    m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+    m20, m21, m22, m23, m24, m25, m26, m27, m28, m29,
+    m30, m31, m32, m33, m34, m35, m36, m37, m38, m39,
+    m40, m41, m42, m43, m44, m45, m46, m47, m48, m49,
+    m50, m51, m52, m53, m54, m55, m56, m57, m58, m59,
+    m60, m61, m62, m63, m64, m65, m66, m67, m68, m69
+);
+
+BOOST_HANA_ADAPT_ADT(ns::AdaptedADT,
+    (m0, [](auto const& d) { return d.m0; }),
+    (m1, [](auto const& d) { return d.m1; }),
+    (m2, [](auto const& d) { return d.m2; }),
+    (m3, [](auto const& d) { return d.m3; }),
+    (m4, [](auto const& d) { return d.m4; }),
+    (m5, [](auto const& d) { return d.m5; }),
+    (m6, [](auto const& d) { return d.m6; }),
+    (m7, [](auto const& d) { return d.m7; }),
+    (m8, [](auto const& d) { return d.m8; }),
+    (m9, [](auto const& d) { return d.m9; }),
+    (m10, [](auto const& d) { return d.m10; }),
+    (m11, [](auto const& d) { return d.m11; }),
+    (m12, [](auto const& d) { return d.m12; }),
+    (m13, [](auto const& d) { return d.m13; }),
+    (m14, [](auto const& d) { return d.m14; }),
+    (m15, [](auto const& d) { return d.m15; }),
+    (m16, [](auto const& d) { return d.m16; }),
+    (m17, [](auto const& d) { return d.m17; }),
+    (m18, [](auto const& d) { return d.m18; }),
+    (m19, [](auto const& d) { return d.m19; }),
+    (m20, [](auto const& d) { return d.m20; }),
+    (m21, [](auto const& d) { return d.m21; }),
+    (m22, [](auto const& d) { return d.m22; }),
+    (m23, [](auto const& d) { return d.m23; }),
+    (m24, [](auto const& d) { return d.m24; }),
+    (m25, [](auto const& d) { return d.m25; }),
+    (m26, [](auto const& d) { return d.m26; }),
+    (m27, [](auto const& d) { return d.m27; }),
+    (m28, [](auto const& d) { return d.m28; }),
+    (m29, [](auto const& d) { return d.m29; }),
+    (m30, [](auto const& d) { return d.m30; }),
+    (m31, [](auto const& d) { return d.m31; }),
+    (m32, [](auto const& d) { return d.m32; }),
+    (m33, [](auto const& d) { return d.m33; }),
+    (m34, [](auto const& d) { return d.m34; }),
+    (m35, [](auto const& d) { return d.m35; }),
+    (m36, [](auto const& d) { return d.m36; }),
+    (m37, [](auto const& d) { return d.m37; }),
+    (m38, [](auto const& d) { return d.m38; }),
+    (m39, [](auto const& d) { return d.m39; }),
+    (m40, [](auto const& d) { return d.m40; }),
+    (m41, [](auto const& d) { return d.m41; }),
+    (m42, [](auto const& d) { return d.m42; }),
+    (m43, [](auto const& d) { return d.m43; }),
+    (m44, [](auto const& d) { return d.m44; }),
+    (m45, [](auto const& d) { return d.m45; }),
+    (m46, [](auto const& d) { return d.m46; }),
+    (m47, [](auto const& d) { return d.m47; }),
+    (m48, [](auto const& d) { return d.m48; }),
+    (m49, [](auto const& d) { return d.m49; }),
+    (m50, [](auto const& d) { return d.m50; }),
+    (m51, [](auto const& d) { return d.m51; }),
+    (m52, [](auto const& d) { return d.m52; }),
+    (m53, [](auto const& d) { return d.m53; }),
+    (m54, [](auto const& d) { return d.m54; }),
+    (m55, [](auto const& d) { return d.m55; }),
+    (m56, [](auto const& d) { return d.m56; }),
+    (m57, [](auto const& d) { return d.m57; }),
+    (m58, [](auto const& d) { return d.m58; }),
+    (m59, [](auto const& d) { return d.m59; }),
+    (m60, [](auto const& d) { return d.m60; }),
+    (m61, [](auto const& d) { return d.m61; }),
+    (m62, [](auto const& d) { return d.m62; }),
+    (m63, [](auto const& d) { return d.m63; }),
+    (m64, [](auto const& d) { return d.m64; }),
+    (m65, [](auto const& d) { return d.m65; }),
+    (m66, [](auto const& d) { return d.m66; }),
+    (m67, [](auto const& d) { return d.m67; }),
+    (m68, [](auto const& d) { return d.m68; }),
+    (m69, [](auto const& d) { return d.m69; })
+);
+
+static_assert(hana::Struct<Defined>::value, "");
+static_assert(hana::Struct<ns::Adapted>::value, "");
+static_assert(hana::Struct<ns::AdaptedADT>::value, "");
+
+template <typename T>
+void check() {
+    T t{};
+    t.m0 = 0;
+    t.m35 = 35;
+    t.m69 = 69;
+
+    BOOST_HANA_CONSTANT_CHECK(hana::length(hana::keys(t)) == hana::size_c<70>);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_key(t, BOOST_HANA_STRING("m0")) == 0);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_key(t, BOOST_HANA_STRING("m35")) == 35);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_key(t, BOOST_HANA_STRING("m69")) == 69);
+}
+
+int main() {
+    check<Defined>();
+    check<ns::Adapted>();
+    check<ns::AdaptedADT>();
+}
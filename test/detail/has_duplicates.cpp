@@ -2,8 +2,11 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/detail/has_duplicates.hpp>
+#include <boost/hana/hash.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/type.hpp>
 namespace hana = boost::hana;
 
 
@@ -54,4 +57,42 @@ static_assert(hana::detail::has_duplicates<
     hana::int_<0>, hana::int_<1>, hana::int_<2>, hana::long_<1>
 >::value, "");
 
+// Make sure it works when the hashes of distinct elements collide
+template <int i>
+struct K { };
+
+struct the_hash;
+
+namespace boost { namespace hana {
+    template <int i>
+    struct hash_impl<K<i>> {
+        static constexpr auto apply(K<i> const&)
+        { return hana::type_c<the_hash>; }
+    };
+}}
+
+template <int i, int j>
+constexpr auto operator==(K<i> const&, K<j> const&)
+{ return hana::bool_c<i == j>; }
+
+template <int i, int j>
+constexpr auto operator!=(K<i> const&, K<j> const&)
+{ return hana::bool_c<i != j>; }
+
+static_assert(!hana::detail::has_duplicates<
+    K<0>, K<1>, K<2>
+>::value, "");
+
+static_assert(!hana::detail::has_duplicates<
+    K<0>, hana::int_<0>, K<1>, hana::int_<1>
+>::value, "");
+
+static_assert(hana::detail::has_duplicates<
+    K<0>, K<1>, K<0>
+>::value, "");
+
+static_assert(hana::detail::has_duplicates<
+    K<0>, hana::int_<0>, K<1>, hana::long_<0>
+>::value, "");
+
 int main() { }
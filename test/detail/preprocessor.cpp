@@ -96,6 +96,26 @@ static_assert(BOOST_HANA_PP_FRONT(0, 1, 2, 3, 4, 5, 6, 6, 8, 9,
                                   10, 11, 12, 13, 14, 15, 16, 16, 18, 19) == 0, "");
 
 
+//////////////////////////////////////////////////////////////////////////////
+// BOOST_HANA_PP_FOR_EACH
+//////////////////////////////////////////////////////////////////////////////
+#define ADD(data, x) + data * x
+static_assert(0 BOOST_HANA_PP_FOR_EACH(ADD, 2) == 0, "");
+static_assert(0 BOOST_HANA_PP_FOR_EACH(ADD, 2, 1) == 2, "");
+static_assert(0 BOOST_HANA_PP_FOR_EACH(ADD, 2, 1, 2, 3) == 12, "");
+
+// Go past the first chunk of arguments, and past the limit of BOOST_HANA_PP_NARG
+static_assert(0 BOOST_HANA_PP_FOR_EACH(ADD, 1,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69
+) == 69 * 70 / 2, "");
+
+
 int main() {
     using Vector = std::vector<int>;
 
@@ -165,4 +185,33 @@ int main() {
         Vector args = {BOOST_HANA_PP_DROP_FRONT(0, 1, 2, 3, 4)};
         BOOST_HANA_RUNTIME_CHECK(args == Vector{1, 2, 3, 4});
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    // BOOST_HANA_PP_ENUM
+    //////////////////////////////////////////////////////////////////////////
+#define PLUS(data, x) data + x
+    {
+        Vector args = {BOOST_HANA_PP_ENUM(PLUS, 10)};
+        BOOST_HANA_RUNTIME_CHECK(args.empty());
+    }{
+        Vector args = {BOOST_HANA_PP_ENUM(PLUS, 10, 0)};
+        BOOST_HANA_RUNTIME_CHECK(args == Vector{10});
+    }{
+        Vector args = {BOOST_HANA_PP_ENUM(PLUS, 10, 0, 1, 2)};
+        BOOST_HANA_RUNTIME_CHECK(args == Vector{10, 11, 12});
+    }{
+        Vector args = {BOOST_HANA_PP_ENUM(PLUS, 0,
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+            10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+            20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+            30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+            40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+            50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+            60, 61, 62, 63, 64, 65, 66, 67, 68, 69
+        )};
+        Vector expected;
+        for (int i = 0; i != 70; ++i)
+            expected.push_back(i);
+        BOOST_HANA_RUNTIME_CHECK(args == expected);
+    }
 }
@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/type_at.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+
+using Pack = hana::detail::type_pack<x<0>, x<1>&, x<2> const&&, x<0>>;
+static_assert(std::is_same<Pack::at<0>, x<0>>{}, "");
+static_assert(std::is_same<Pack::at<1>, x<1>&>{}, "");
+static_assert(std::is_same<Pack::at<2>, x<2> const&&>{}, "");
+static_assert(std::is_same<Pack::at<3>, x<0>>{}, "");
+
+static_assert(std::is_same<hana::detail::type_at<0, x<0>>, x<0>>{}, "");
+static_assert(std::is_same<hana::detail::type_at<0, x<0>, x<1>>, x<0>>{}, "");
+static_assert(std::is_same<hana::detail::type_at<1, x<0>, x<1>>, x<1>>{}, "");
+static_assert(std::is_same<hana::detail::type_at<2, x<0>, x<1>, void>, void>{}, "");
+
+int main() { }
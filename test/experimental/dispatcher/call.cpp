@@ -0,0 +1,80 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/dispatcher.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <typename T>
+std::string name();
+template <> std::string name<char>() { return "char"; }
+template <> std::string name<int>() { return "int"; }
+template <> std::string name<long>() { return "long"; }
+
+int main() {
+    // keys are mixed-radix, with the last dimension varying the fastest
+    {
+        auto d = hana::experimental::make_dispatcher<int()>(
+            hana::make_tuple(hana::tuple_t<char, int>, hana::range_c<int, 0, 3>),
+            [](auto, auto) { return 0; }
+        );
+        static_assert(decltype(d)::size() == 6, "");
+        static_assert(decltype(d)::key(0, 0) == 0, "");
+        static_assert(decltype(d)::key(0, 2) == 2, "");
+        static_assert(decltype(d)::key(1, 0) == 3, "");
+        static_assert(decltype(d)::key(1, 2) == 5, "");
+    }
+
+    // the function is called with the elements of each dimension
+    {
+        auto d = hana::experimental::make_dispatcher<std::string(std::string const&)>(
+            hana::make_tuple(hana::tuple_t<char, int, long>, hana::range_c<int, 1, 4>),
+            [](auto t, auto n, std::string const& prefix) {
+                using T = typename decltype(t)::type;
+                return prefix + name<T>() + std::to_string(decltype(n)::value);
+            }
+        );
+        BOOST_HANA_RUNTIME_CHECK(d(d.key(0, 0), "x") == "xchar1");
+        BOOST_HANA_RUNTIME_CHECK(d(d.key(1, 2), "y") == "yint3");
+        BOOST_HANA_RUNTIME_CHECK(d(d.key(2, 1), "z") == "zlong2");
+        for (int i = 0; i != 3; ++i)
+            for (int j = 0; j != 3; ++j)
+                BOOST_HANA_RUNTIME_CHECK(d(d.key(i, j), "").back() == '1' + j);
+    }
+
+    // a single dimension
+    {
+        auto d = hana::experimental::make_dispatcher<std::size_t()>(
+            hana::make_tuple(hana::tuple_t<char, int, long>),
+            [](auto t) { return sizeof(typename decltype(t)::type); }
+        );
+        BOOST_HANA_RUNTIME_CHECK(d(0) == sizeof(char));
+        BOOST_HANA_RUNTIME_CHECK(d(2) == sizeof(long));
+    }
+
+    // the function may hold state, and arguments are forwarded
+    {
+        int calls = 0;
+        auto d = hana::experimental::make_dispatcher<void(std::unique_ptr<int>, int&)>(
+            hana::make_tuple(hana::range_c<int, 0, 2>),
+            [&calls](auto n, std::unique_ptr<int> p, int& out) {
+                ++calls;
+                out = *p + decltype(n)::value;
+            }
+        );
+        int out = 0;
+        d(1, std::make_unique<int>(41), out);
+        BOOST_HANA_RUNTIME_CHECK(out == 42);
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+}
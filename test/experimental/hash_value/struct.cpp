@@ -0,0 +1,77 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/hash_value.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <unordered_set>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Labelled {
+    BOOST_HANA_DEFINE_STRUCT(Labelled,
+        (std::string, label),
+        (Point, where),
+        (hana::tuple<int, char>, extra)
+    );
+};
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+struct equal_to {
+    template <typename X, typename Y>
+    bool operator()(X const& x, Y const& y) const
+    { return hana::equal(x, y); }
+};
+
+int main() {
+    auto hash = hana::experimental::hash_value;
+
+    // equal objects have equal hashes
+    {
+        BOOST_HANA_RUNTIME_CHECK(hash(Point{1, 2}) == hash(Point{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(hash(Empty{}) == hash(Empty{}));
+        BOOST_HANA_RUNTIME_CHECK(
+            hash(Labelled{"a", {1, 2}, hana::make_tuple(3, 'x')}) ==
+            hash(Labelled{"a", {1, 2}, hana::make_tuple(3, 'x')})
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hash(hana::make_tuple(Point{1, 2}, 3)) ==
+            hash(hana::make_tuple(Point{1, 2}, 3))
+        );
+    }
+
+    // members are hashed in order, so that swapping them changes the hash
+    {
+        BOOST_HANA_RUNTIME_CHECK(hash(Point{1, 2}) != hash(Point{2, 1}));
+        BOOST_HANA_RUNTIME_CHECK(
+            hash(Labelled{"a", {1, 2}, hana::make_tuple(3, 'x')}) !=
+            hash(Labelled{"a", {1, 2}, hana::make_tuple(3, 'y')})
+        );
+    }
+
+    // usable as the hash function of a standard unordered container
+    {
+        std::unordered_set<Point, hana::experimental::hasher, equal_to> points;
+        points.insert(Point{1, 2});
+        points.insert(Point{3, 4});
+        points.insert(Point{1, 2});
+        BOOST_HANA_RUNTIME_CHECK(points.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(points.count(Point{3, 4}) == 1);
+        BOOST_HANA_RUNTIME_CHECK(points.count(Point{4, 3}) == 0);
+    }
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/integral_constant.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_c<0>(ints<3, 1, 2>{}),
+        hana::int_c<3>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_c<2>(ints<3, 1, 2>{}),
+        hana::int_c<2>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        ints<3, 1, 2>{}[hana::size_c<1>],
+        hana::int_c<1>
+    ));
+}
@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/not_equal.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(ints<>{}, ints<>{}));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(ints<1, 2>{}, ints<1, 2>{}));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(ints<1, 2>{}, hana::experimental::integers<long, 1, 2>{}));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(ints<1, 2>{}, ints<1, 3>{})));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(ints<1, 2>{}, ints<1>{})));
+
+    // operators
+    BOOST_HANA_CONSTANT_CHECK(ints<1, 2>{} == ints<1, 2>{});
+    BOOST_HANA_CONSTANT_CHECK(ints<1, 2>{} != ints<2, 1>{});
+}
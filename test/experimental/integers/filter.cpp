@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/integral_constant.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+struct is_odd {
+    template <typename X>
+    constexpr auto operator()(X const&) const
+    { return hana::bool_c<(X::value % 2 != 0)>; }
+};
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(ints<>{}, is_odd{}),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(ints<1, 2, 3, 4, 5>{}, is_odd{}),
+        ints<1, 3, 5>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(ints<1, 2, 3, 4, 5>{}, hana::equal.to(hana::int_c<4>)),
+        ints<4>{}
+    ));
+}
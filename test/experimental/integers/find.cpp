@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/optional.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(ints<>{}, hana::int_c<0>),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(ints<3, -1, 8>{}, hana::int_c<8>),
+        hana::just(hana::int_c<8>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(ints<3, -1, 8>{}, hana::long_c<-1>),
+        hana::just(hana::int_c<-1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(ints<3, -1, 8>{}, hana::int_c<2>),
+        hana::nothing
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(ints<>{}, hana::int_c<0>)));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(ints<3, -1, 8>{}, hana::int_c<8>));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(ints<3, -1, 8>{}, hana::int_c<2>)));
+}
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/remove_at.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(ints<>{}, hana::size_c<0>, hana::int_c<9>),
+        ints<9>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(ints<1, 2, 3>{}, hana::size_c<1>, hana::int_c<9>),
+        ints<1, 9, 2, 3>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::remove_at(ints<1, 2, 3>{}, hana::size_c<0>),
+        ints<2, 3>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::remove_at(ints<1, 2, 3>{}, hana::size_c<2>),
+        ints<1, 2>{}
+    ));
+}
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/maximum.hpp>
+#include <boost/hana/minimum.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::maximum(ints<3>{}),
+        hana::int_c<3>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::maximum(ints<3, -1, 8, 2>{}),
+        hana::int_c<8>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::minimum(ints<3>{}),
+        hana::int_c<3>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::minimum(ints<3, -1, 8, 2>{}),
+        hana::int_c<-1>
+    ));
+}
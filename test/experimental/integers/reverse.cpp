@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/reverse.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(ints<>{}),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(ints<1>{}),
+        ints<1>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(ints<1, 2, 3>{}),
+        ints<3, 2, 1>{}
+    ));
+}
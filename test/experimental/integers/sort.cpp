@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/greater.hpp>
+#include <boost/hana/sort.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+struct greater {
+    template <typename X, typename Y>
+    constexpr auto operator()(X const&, Y const&) const
+    { return hana::bool_c<(X::value > Y::value)>; }
+};
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(ints<>{}),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(ints<1>{}),
+        ints<1>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(ints<3, -1, 8, 2, -1>{}),
+        ints<-1, -1, 2, 3, 8>{}
+    ));
+
+    // with a predicate
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(ints<3, -1, 8, 2, -1>{}, greater{}),
+        ints<8, 3, 2, -1, -1>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(ints<3, -1, 8, 2, -1>{}, hana::greater),
+        ints<8, 3, 2, -1, -1>{}
+    ));
+}
@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/drop_back.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/take_front.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(ints<1, 2, 3>{}, hana::size_c<2>),
+        ints<1, 2>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(ints<1, 2, 3>{}, hana::size_c<5>),
+        ints<1, 2, 3>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(ints<1, 2, 3>{}, hana::size_c<2>),
+        ints<1>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(ints<1, 2, 3>{}, hana::size_c<5>),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_front(ints<1, 2, 3>{}, hana::size_c<2>),
+        ints<3>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_front(ints<1, 2, 3>{}, hana::size_c<5>),
+        ints<>{}
+    ));
+}
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::experimental::integers_tag>(hana::make_tuple()),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::experimental::integers_tag>(hana::tuple_c<int, 3, 1, 2>),
+        ints<3, 1, 2>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::experimental::integers_tag>(hana::make_tuple(hana::int_c<1>, hana::long_c<2>)),
+        hana::experimental::integers<long, 1, 2>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::tuple_tag>(ints<3, 1, 2>{}),
+        hana::tuple_c<int, 3, 1, 2>
+    ));
+}
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/unique.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<>{}),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<1, 1, 2, 1, 3, 3>{}),
+        ints<1, 2, 1, 3>{}
+    ));
+
+    // with a predicate
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<1, 1, 2, 1, 3, 3>{}, hana::equal),
+        ints<1, 2, 1, 3>{}
+    ));
+}
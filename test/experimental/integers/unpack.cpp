@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/integers.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = hana::experimental::integers<int, v...>;
+
+struct f_t {
+    template <typename ...X>
+    constexpr auto operator()(X const& ...x) const
+    { return hana::make_tuple(x...); }
+};
+
+int main() {
+    f_t f{};
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(ints<>{}, f),
+        f()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(ints<0>{}, f),
+        f(hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(ints<0, 3, -1>{}, f),
+        f(hana::int_c<0>, hana::int_c<3>, hana::int_c<-1>)
+    ));
+}
@@ -0,0 +1,175 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned, age),
+        (bool, admin),
+        (double, score),
+        (Point, home),
+        (hana::tuple<int, std::string>, extra)
+    );
+};
+
+// enough keys for the hash table not to be trivial
+struct Many {
+    BOOST_HANA_DEFINE_STRUCT(Many,
+        (int, a), (int, b), (int, c), (int, d), (int, e), (int, f), (int, g),
+        (int, h), (int, i), (int, j), (int, k), (int, l), (int, m), (int, n),
+        (int, o), (int, p), (int, q), (int, r), (int, s), (int, t), (int, u),
+        (int, ab), (int, ba), (int, abc), (int, cba), (int, bca), (int, aa)
+    );
+};
+
+// Reads `x` from the whole string `json`, and returns whether it succeeded.
+template <typename T>
+bool read(T& x, char const* json) {
+    char const* last = json + std::strlen(json);
+    char const* end = hana::experimental::from_json(x, json, last);
+    return end == last;
+}
+
+template <typename T>
+T round_trip(T const& x) {
+    std::string out;
+    hana::experimental::to_json(x, out);
+    T y{};
+    BOOST_HANA_RUNTIME_CHECK(read(y, out.c_str()));
+    return y;
+}
+
+int main() {
+    // round trips
+    {
+        Person john{"John \"J\" Doe\n", 30, true, 0.1, {1, -2}, hana::make_tuple(3, "x")};
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(round_trip(john), john));
+        BOOST_HANA_RUNTIME_CHECK(round_trip(INT64_MIN) == INT64_MIN);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(UINT64_MAX) == UINT64_MAX);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(1.0 / 3) == 1.0 / 3);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(0.1f) == 0.1f);
+
+        Many many{};
+        many.a = 1; many.u = 2; many.aa = 3; many.cba = 4;
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(round_trip(many), many));
+    }
+
+    // members may appear in any order, with whitespace, and unknown
+    // members are skipped
+    {
+        Person p{};
+        p.name = "unchanged";
+        BOOST_HANA_RUNTIME_CHECK(read(p, R"( {
+            "unknown": {"nested": [1, "}", {"a": null}], "b": -1.5e3},
+            "home" : { "y" : 2 , "x" : 1 } ,
+            "age": 42, "admin": true, "other": "a\"b", "score": -0.25,
+            "extra": [ 7 , "seven" ]
+        })"));
+        BOOST_HANA_RUNTIME_CHECK(p.name == "unchanged");
+        BOOST_HANA_RUNTIME_CHECK(p.age == 42);
+        BOOST_HANA_RUNTIME_CHECK(p.admin);
+        BOOST_HANA_RUNTIME_CHECK(p.score == -0.25);
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(p.home, Point{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(p.extra, hana::make_tuple(7, "seven")));
+
+        Many many{};
+        BOOST_HANA_RUNTIME_CHECK(read(many, R"({"aa": 1, "ab": 2, "ba": 3, "abc": 4, "bca": 5, "cb": 6})"));
+        BOOST_HANA_RUNTIME_CHECK(many.aa == 1 && many.ab == 2 && many.ba == 3 &&
+                                 many.abc == 4 && many.bca == 5 && many.cba == 0);
+    }
+
+    // escapes in strings
+    {
+        std::string s;
+        BOOST_HANA_RUNTIME_CHECK(read(s, R"("a\"\\\/\b\f\n\r\t")"));
+        BOOST_HANA_RUNTIME_CHECK(s == "a\"\\/\b\f\n\r\t");
+        BOOST_HANA_RUNTIME_CHECK(read(s, R"("A\u00e9\u20ac\ud83d\ude00")"));
+        BOOST_HANA_RUNTIME_CHECK(s == "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+    }
+
+    // hana::optional and hana::map
+    {
+        auto o = hana::just(Point{});
+        BOOST_HANA_RUNTIME_CHECK(read(o, R"({"x": 1, "y": 2})"));
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(o.value(), Point{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(!read(o, "null"));
+
+        auto nothing = hana::nothing;
+        BOOST_HANA_RUNTIME_CHECK(read(nothing, "null"));
+        BOOST_HANA_RUNTIME_CHECK(!read(nothing, "0"));
+
+        auto m = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("id"), 0),
+            hana::make_pair(BOOST_HANA_STRING("where"), Point{})
+        );
+        BOOST_HANA_RUNTIME_CHECK(read(m, R"({"where": {"x": 1, "y": 2}, "id": 7})"));
+        BOOST_HANA_RUNTIME_CHECK(m[BOOST_HANA_STRING("id")] == 7);
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(m[BOOST_HANA_STRING("where")], Point{1, 2}));
+    }
+
+    // the end of what was read is returned
+    {
+        char const json[] = "[1, 2] trailing";
+        hana::tuple<int, int> xs;
+        char const* end = hana::experimental::from_json(xs, json, json + sizeof(json) - 1);
+        BOOST_HANA_RUNTIME_CHECK(end == json + 6);
+    }
+
+    // invalid input
+    {
+        int i;
+        BOOST_HANA_RUNTIME_CHECK(!read(i, ""));
+        BOOST_HANA_RUNTIME_CHECK(!read(i, "1.5"));
+        BOOST_HANA_RUNTIME_CHECK(!read(i, "-"));
+        BOOST_HANA_RUNTIME_CHECK(!read(i, "2147483648"));
+        BOOST_HANA_RUNTIME_CHECK(read(i, "-2147483648") && i == INT32_MIN);
+
+        std::uint8_t u;
+        BOOST_HANA_RUNTIME_CHECK(!read(u, "256"));
+        BOOST_HANA_RUNTIME_CHECK(!read(u, "-1"));
+        BOOST_HANA_RUNTIME_CHECK(read(u, "255") && u == 255);
+
+        bool b;
+        BOOST_HANA_RUNTIME_CHECK(!read(b, "tru"));
+        BOOST_HANA_RUNTIME_CHECK(!read(b, "null"));
+
+        std::string s;
+        BOOST_HANA_RUNTIME_CHECK(!read(s, R"("abc)"));
+        BOOST_HANA_RUNTIME_CHECK(!read(s, R"("\x")"));
+        BOOST_HANA_RUNTIME_CHECK(!read(s, R"("\ud83d")"));
+
+        Point p;
+        BOOST_HANA_RUNTIME_CHECK(!read(p, R"({"x": 1,})"));
+        BOOST_HANA_RUNTIME_CHECK(!read(p, R"({"x" 1})"));
+        BOOST_HANA_RUNTIME_CHECK(!read(p, R"({"z": [1, 2})"));
+
+        hana::tuple<int, int> xs;
+        BOOST_HANA_RUNTIME_CHECK(!read(xs, "[1]"));
+        BOOST_HANA_RUNTIME_CHECK(!read(xs, "[1, 2, 3]"));
+    }
+}
@@ -0,0 +1,125 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_adt.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned, age),
+        (bool, admin),
+        (Point, home)
+    );
+};
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+namespace ns {
+    class Coordinates {
+        int x_, y_;
+    public:
+        Coordinates(int x, int y) : x_(x), y_(y) { }
+        int x() const { return x_; }
+        int y() const { return y_; }
+    };
+}
+
+BOOST_HANA_ADAPT_ADT(ns::Coordinates,
+    (x, [](auto const& c) { return c.x(); }),
+    (y, [](auto const& c) { return c.y(); })
+);
+
+template <typename T>
+std::string json(T const& x) {
+    std::string out;
+    hana::experimental::to_json(x, out);
+    return out;
+}
+
+int main() {
+    // arithmetic types
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(true) == "true");
+        BOOST_HANA_RUNTIME_CHECK(json(false) == "false");
+        BOOST_HANA_RUNTIME_CHECK(json(0) == "0");
+        BOOST_HANA_RUNTIME_CHECK(json(-42) == "-42");
+        BOOST_HANA_RUNTIME_CHECK(json(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+        BOOST_HANA_RUNTIME_CHECK(json(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+        BOOST_HANA_RUNTIME_CHECK(json(1.5) == "1.5");
+        BOOST_HANA_RUNTIME_CHECK(json(std::numeric_limits<double>::infinity()) == "null");
+    }
+
+    // strings are escaped
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{}) == R"("")");
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{"abc"}) == R"("abc")");
+        BOOST_HANA_RUNTIME_CHECK(json(std::string{"a\"b\\c\n\x01"}) == R"("a\"b\\c\n\u0001")");
+    }
+
+    // Structs
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(Point{1, -2}) == R"({"x":1,"y":-2})");
+        BOOST_HANA_RUNTIME_CHECK(json(Empty{}) == "{}");
+        BOOST_HANA_RUNTIME_CHECK(json(Person{"John", 30, false, {1, 2}}) ==
+            R"({"name":"John","age":30,"admin":false,"home":{"x":1,"y":2}})");
+        BOOST_HANA_RUNTIME_CHECK(json(ns::Coordinates{3, 4}) == R"({"x":3,"y":4})");
+    }
+
+    // Sequences
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(hana::make_tuple()) == "[]");
+        BOOST_HANA_RUNTIME_CHECK(json(hana::make_tuple(1)) == "[1]");
+        BOOST_HANA_RUNTIME_CHECK(json(hana::make_tuple(1, std::string{"a"}, Point{2, 3})) ==
+            R"([1,"a",{"x":2,"y":3}])");
+    }
+
+    // hana::optional
+    {
+        BOOST_HANA_RUNTIME_CHECK(json(hana::nothing) == "null");
+        BOOST_HANA_RUNTIME_CHECK(json(hana::just(3)) == "3");
+        BOOST_HANA_RUNTIME_CHECK(json(hana::make_tuple(hana::just(Point{1, 2}), hana::nothing)) ==
+            R"([{"x":1,"y":2},null])");
+    }
+
+    // hana::map
+    {
+        auto m = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("id"), 7),
+            hana::make_pair(BOOST_HANA_STRING("where"), Point{1, 2})
+        );
+        BOOST_HANA_RUNTIME_CHECK(json(m) == R"({"id":7,"where":{"x":1,"y":2}})");
+        BOOST_HANA_RUNTIME_CHECK(json(hana::make_map()) == "{}");
+    }
+
+    // appends to any growable buffer of chars
+    {
+        std::vector<char> out{'>'};
+        hana::experimental::to_json(Point{1, 2}, out);
+        BOOST_HANA_RUNTIME_CHECK(std::string(out.begin(), out.end()) == R"(>{"x":1,"y":2})");
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/packed_tuple.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstdint>
+#include <string>
+namespace hana = boost::hana;
+
+
+using Packed = hana::experimental::packed_tuple<
+    char, std::uint64_t, char, std::uint32_t, char
+>;
+using Tuple = hana::tuple<char, std::uint64_t, char, std::uint32_t, char>;
+
+// the packed tuple is no larger than the optimal layout
+constexpr auto layout = hana::experimental::packed_layout(hana::tuple_t<
+    char, std::uint64_t, char, std::uint32_t, char
+>);
+static_assert(sizeof(Packed) == layout.size, "");
+static_assert(sizeof(Packed) < sizeof(Tuple), "");
+
+int main() {
+    // elements are accessed in their original order
+    {
+        constexpr Packed xs{'a', 1, 'b', 2, 'c'};
+        static_assert(hana::at_c<0>(xs) == 'a', "");
+        static_assert(hana::at_c<1>(xs) == 1, "");
+        static_assert(hana::at_c<2>(xs) == 'b', "");
+        static_assert(hana::at_c<3>(xs) == 2, "");
+        static_assert(hana::at_c<4>(xs) == 'c', "");
+        BOOST_HANA_CONSTEXPR_CHECK(hana::equal(
+            hana::unpack(xs, hana::make_tuple),
+            Tuple{'a', 1, 'b', 2, 'c'}
+        ));
+    }
+
+    // elements can be modified through at
+    {
+        Packed xs{'a', 1, 'b', 2, 'c'};
+        hana::at_c<1>(xs) = 42;
+        hana::at_c<4>(xs) = 'z';
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == 42);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<4>(xs) == 'z');
+    }
+
+    // elements are moved in and out
+    {
+        std::string s(100, 'x');
+        hana::experimental::packed_tuple<char, std::string> xs{'a', std::move(s)};
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == std::string(100, 'x'));
+        std::string t = hana::at_c<1>(std::move(xs));
+        BOOST_HANA_RUNTIME_CHECK(t == std::string(100, 'x'));
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs).empty());
+    }
+
+    // copy
+    {
+        Packed xs{'a', 1, 'b', 2, 'c'};
+        Packed ys = xs;
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(ys, xs));
+        hana::experimental::packed_tuple<int> one{1};
+        hana::experimental::packed_tuple<int> two = one;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(two) == 1);
+    }
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/packed_tuple.hpp>
+
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/iterable.hpp>
+#include <laws/sequence.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto eq_tuples = hana::make_tuple(
+          hana::experimental::make_packed_tuple()
+        , hana::experimental::make_packed_tuple(ct_eq<0>{})
+        , hana::experimental::make_packed_tuple(ct_eq<0>{}, ct_eq<1>{})
+        , hana::experimental::make_packed_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        , hana::experimental::make_packed_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{})
+    );
+
+    hana::test::TestComparable<hana::experimental::packed_tuple_tag>{eq_tuples};
+    hana::test::TestFoldable<hana::experimental::packed_tuple_tag>{eq_tuples};
+    hana::test::TestIterable<hana::experimental::packed_tuple_tag>{eq_tuples};
+    hana::test::TestSequence<hana::experimental::packed_tuple_tag>{};
+}
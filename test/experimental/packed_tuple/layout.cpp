@@ -0,0 +1,83 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/packed_tuple.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+namespace hana = boost::hana;
+
+
+struct expected {
+    std::uint64_t b;
+    std::uint32_t d;
+    std::uint16_t c;
+    char a;
+    char e;
+};
+
+int main() {
+    // elements are stored by decreasing alignment, and ties keep their order
+    {
+        constexpr auto layout = hana::experimental::packed_layout(hana::tuple_t<
+            char, std::uint64_t, std::uint16_t, std::uint32_t, char
+        >);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            layout.order,
+            hana::tuple_c<std::size_t, 1, 3, 2, 0, 4>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            layout.indices,
+            hana::tuple_c<std::size_t, 3, 0, 2, 1, 4>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            layout.offsets,
+            hana::make_tuple(
+                hana::size_c<offsetof(expected, a)>,
+                hana::size_c<offsetof(expected, b)>,
+                hana::size_c<offsetof(expected, c)>,
+                hana::size_c<offsetof(expected, d)>,
+                hana::size_c<offsetof(expected, e)>
+            )
+        ));
+        BOOST_HANA_CONSTANT_CHECK(layout.size == hana::size_c<sizeof(expected)>);
+        BOOST_HANA_CONSTANT_CHECK(layout.alignment == hana::size_c<alignof(expected)>);
+    }
+
+    // the order is the identity when there's nothing to gain
+    {
+        constexpr auto layout = hana::experimental::packed_layout(hana::tuple_t<
+            int, int, char
+        >);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            layout.order,
+            hana::tuple_c<std::size_t, 0, 1, 2>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(layout.size == hana::size_c<3 * sizeof(int)>);
+    }
+
+    // references are laid out like pointers
+    {
+        constexpr auto layout = hana::experimental::packed_layout(hana::tuple_t<
+            char, char&
+        >);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            layout.order,
+            hana::tuple_c<std::size_t, 1, 0>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(layout.size == hana::size_c<2 * sizeof(char*)>);
+    }
+
+    // empty layout
+    {
+        constexpr auto layout = hana::experimental::packed_layout(hana::tuple_t<>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(layout.order, hana::tuple_c<std::size_t>));
+        BOOST_HANA_CONSTANT_CHECK(layout.size == hana::size_c<0>);
+    }
+}
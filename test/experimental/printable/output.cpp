@@ -0,0 +1,67 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/printable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// A model of Printable returning a string, which is still supported.
+struct Legacy { };
+namespace boost { namespace hana { namespace experimental {
+    template <>
+    struct print_impl<Legacy> {
+        static std::string apply(Legacy const&) { return "legacy"; }
+    };
+}}}
+
+int main() {
+    auto nested = hana::make_tuple(
+        1,
+        hana::make_map(hana::make_pair(hana::int_c<1>, hana::just('x'))),
+        hana::make_tuple(hana::type_c<int>, hana::nothing, Legacy{})
+    );
+    std::string const expected = "(1, {1 => just(x)}, (type<int>, nothing, legacy))";
+
+    // returning a std::string
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::print(nested) == expected);
+    }
+
+    // writing to a std::ostream
+    {
+        std::ostringstream ss;
+        ss << '>';
+        std::ostream& os = hana::experimental::print(nested, ss);
+        BOOST_HANA_RUNTIME_CHECK(&os == &ss);
+        BOOST_HANA_RUNTIME_CHECK(ss.str() == '>' + expected);
+    }
+
+    // writing to an output iterator
+    {
+        std::vector<char> out;
+        auto it = hana::experimental::print(nested, std::back_inserter(out));
+        *it++ = '!';
+        BOOST_HANA_RUNTIME_CHECK(std::string(out.begin(), out.end()) == expected + '!');
+    }
+
+    // writing more than what the internal buffer holds
+    {
+        std::string long_string(1000, 'a');
+        char out[1010] = {};
+        char* end = hana::experimental::print(hana::make_tuple(long_string), out);
+        BOOST_HANA_RUNTIME_CHECK(std::string(out, end) == '(' + long_string + ')');
+    }
+}
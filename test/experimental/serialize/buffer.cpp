@@ -0,0 +1,139 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_adt.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Padded {
+    BOOST_HANA_DEFINE_STRUCT(Padded,
+        (char, c),
+        (int, i)
+    );
+};
+
+struct Path {
+    BOOST_HANA_DEFINE_STRUCT(Path,
+        (char, id),
+        (std::vector<Point>, points)
+    );
+};
+
+namespace ns {
+    class Coordinates {
+        int x_, y_;
+    public:
+        Coordinates(int x, int y) : x_(x), y_(y) { }
+        int x() const { return x_; }
+        int y() const { return y_; }
+    };
+}
+
+BOOST_HANA_ADAPT_ADT(ns::Coordinates,
+    (x, [](auto const& c) { return c.x(); }),
+    (y, [](auto const& c) { return c.y(); })
+);
+
+// the maximum size is known at compile-time when there are no std::vectors
+static_assert(hana::experimental::max_serialized_size<int> == sizeof(int), "");
+static_assert(hana::experimental::max_serialized_size<Point> == 2 * sizeof(int), "");
+static_assert(hana::experimental::max_serialized_size<Padded> == 1 + sizeof(int), "");
+static_assert(hana::experimental::max_serialized_size<std::array<Point, 3>> == 6 * sizeof(int), "");
+static_assert(hana::experimental::max_serialized_size<
+    hana::tuple<char, Point, std::array<short, 2>>
+> == 1 + 2 * sizeof(int) + 2 * sizeof(short), "");
+static_assert(hana::experimental::serialized_size(Point{1, 2}) == 2 * sizeof(int), "");
+
+int main() {
+    // the representation is laid out without padding, in the order of the accessors
+    {
+        char buffer[hana::experimental::max_serialized_size<Padded>];
+        char* end = hana::experimental::serialize(Padded{'x', 42}, buffer, buffer + sizeof(buffer));
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + sizeof(buffer));
+        BOOST_HANA_RUNTIME_CHECK(buffer[0] == 'x');
+        int i;
+        std::memcpy(&i, buffer + 1, sizeof(int));
+        BOOST_HANA_RUNTIME_CHECK(i == 42);
+    }
+
+    // std::vectors are prefixed with their size
+    {
+        Path p{'p', {{1, 2}, {3, 4}}};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::serialized_size(p) ==
+                                 1 + sizeof(std::uint64_t) + 4 * sizeof(int));
+        char buffer[64];
+        char* end = hana::experimental::serialize(p, buffer, buffer + sizeof(buffer));
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + hana::experimental::serialized_size(p));
+        std::uint64_t n;
+        std::memcpy(&n, buffer + 1, sizeof n);
+        BOOST_HANA_RUNTIME_CHECK(n == 2);
+    }
+
+    // Structs whose accessors return values can be serialized
+    {
+        char buffer[64];
+        char* end = hana::experimental::serialize(ns::Coordinates{1, 2}, buffer, buffer + sizeof(buffer));
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + 2 * sizeof(int));
+        Point p;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(p, buffer, end) == end);
+        BOOST_HANA_RUNTIME_CHECK(p.x == 1 && p.y == 2);
+    }
+
+    // nothing is written when the buffer is too small
+    {
+        char buffer[2 * sizeof(int)] = {'a', 'b'};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::serialize(
+            Point{1, 2}, buffer, buffer + sizeof(buffer) - 1) == nullptr);
+        BOOST_HANA_RUNTIME_CHECK(buffer[0] == 'a' && buffer[1] == 'b');
+
+        Path p{'p', {{1, 2}}};
+        char path[64] = {'a'};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::serialize(
+            p, path, path + hana::experimental::serialized_size(p) - 1) == nullptr);
+        BOOST_HANA_RUNTIME_CHECK(path[0] == 'a');
+    }
+
+    // reading fails when the buffer ends too early
+    {
+        char buffer[64];
+        char* end = hana::experimental::serialize(Point{1, 2}, buffer, buffer + sizeof(buffer));
+        Point q;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(q, buffer, end - 1) == nullptr);
+
+        Path p{'p', {{1, 2}, {3, 4}}};
+        end = hana::experimental::serialize(p, buffer, buffer + sizeof(buffer));
+        for (char* last = buffer; last != end; ++last) {
+            Path r;
+            BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(r, buffer, last) == nullptr);
+        }
+    }
+
+    // a corrupt size does not make us allocate more than the buffer can hold
+    {
+        char buffer[64];
+        char* end = hana::experimental::serialize(
+            std::vector<int>{1, 2, 3}, buffer, buffer + sizeof(buffer));
+        std::uint64_t huge = std::uint64_t(-1) / 2;
+        std::memcpy(buffer, &huge, sizeof huge);
+        std::vector<int> v;
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::deserialize(v, buffer, end) == nullptr);
+        BOOST_HANA_RUNTIME_CHECK(v.capacity() == 0);
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/serialize.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+namespace hana = boost::hana;
+
+
+enum class Color : std::uint8_t { red, green, blue };
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+
+    friend bool operator==(Point const& a, Point const& b)
+    { return hana::equal(a, b); }
+};
+
+struct Shape {
+    BOOST_HANA_DEFINE_STRUCT(Shape,
+        (Color, color),
+        (Point, origin),
+        (std::array<Point, 2>, box),
+        (hana::tuple<double, char>, extra),
+        (std::vector<Point>, vertices),
+        (std::vector<std::vector<short>>, groups)
+    );
+};
+
+namespace ns {
+    // members adapted in the reverse order of their declaration
+    struct Reversed { int a; int b; int c; };
+}
+BOOST_HANA_ADAPT_STRUCT(ns::Reversed, c, b, a);
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+template <typename T>
+T round_trip(T const& x) {
+    char buffer[1024];
+    char* end = hana::experimental::serialize(x, buffer, buffer + sizeof(buffer));
+    BOOST_HANA_RUNTIME_CHECK(end != nullptr);
+    BOOST_HANA_RUNTIME_CHECK(static_cast<std::size_t>(end - buffer) ==
+                             hana::experimental::serialized_size(x));
+
+    T y{};
+    char const* read = hana::experimental::deserialize(y, buffer, end);
+    BOOST_HANA_RUNTIME_CHECK(read == end);
+    return y;
+}
+
+int main() {
+    // arithmetic types and enumerations
+    {
+        BOOST_HANA_RUNTIME_CHECK(round_trip(42) == 42);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(3.5) == 3.5);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(true) == true);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(Color::blue) == Color::blue);
+    }
+
+    // Structs
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(round_trip(Point{1, 2}), Point{1, 2}));
+        round_trip(Empty{});
+
+        ns::Reversed r = round_trip(ns::Reversed{1, 2, 3});
+        BOOST_HANA_RUNTIME_CHECK(r.a == 1 && r.b == 2 && r.c == 3);
+    }
+
+    // Sequences, std::arrays and std::vectors
+    {
+        auto t = hana::make_tuple(1, 'x', Point{3, 4}, 2.5f);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(t) == t);
+
+        std::array<int, 3> a = {{1, 2, 3}};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(a) == a);
+
+        std::vector<int> v = {1, 2, 3, 4, 5};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(v) == v);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::vector<int>{}).empty());
+
+        std::vector<std::vector<char>> vv = {{'a'}, {}, {'b', 'c'}};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(vv) == vv);
+
+        std::vector<bool> b = {true, false, false, true, true};
+        BOOST_HANA_RUNTIME_CHECK(round_trip(b) == b);
+        BOOST_HANA_RUNTIME_CHECK(round_trip(std::vector<bool>{}).empty());
+    }
+
+    // everything nested
+    {
+        Shape s{Color::green, {1, 2}, {{{3, 4}, {5, 6}}},
+                hana::make_tuple(7.5, 'z'), {{8, 9}, {10, 11}, {12, 13}},
+                {{1, 2}, {}, {3}}};
+        Shape t = round_trip(s);
+        BOOST_HANA_RUNTIME_CHECK(hana::equal(t, s));
+    }
+
+    // deserializing into an object that is not empty replaces its contents
+    {
+        std::vector<int> v = {1, 2, 3};
+        char buffer[64];
+        char* end = hana::experimental::serialize(v, buffer, buffer + sizeof(buffer));
+        std::vector<int> w = {4, 5, 6, 7, 8};
+        hana::experimental::deserialize(w, buffer, end);
+        BOOST_HANA_RUNTIME_CHECK(w == v);
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(hana::experimental::types<>{}, hana::experimental::types<>{}),
+        hana::experimental::types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(hana::experimental::types<x<0>>{}, hana::experimental::types<>{}),
+        hana::experimental::types<x<0>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(hana::experimental::types<>{}, hana::experimental::types<x<0>>{}),
+        hana::experimental::types<x<0>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(hana::experimental::types<x<0>, x<1>>{},
+                     hana::experimental::types<x<2>, x<3>>{}),
+        hana::experimental::types<x<0>, x<1>, x<2>, x<3>>{}
+    ));
+}
@@ -0,0 +1,67 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::experimental::types;
+
+
+template <int> struct x;
+
+template <typename T>
+struct is_even;
+
+template <int i>
+struct is_even<x<i>> : std::integral_constant<bool, i % 2 == 0> { };
+
+struct even {
+    template <int i>
+    constexpr auto operator()(hana::basic_type<x<i>> const&) const
+    { return hana::bool_c<i % 2 == 0>; }
+};
+
+int main() {
+    // with a Metafunction
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types<>{}, hana::trait<is_even>),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types<x<0>>{}, hana::trait<is_even>),
+        types<x<0>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types<x<0>, x<1>, x<2>, x<3>>{}, hana::trait<is_even>),
+        types<x<0>, x<2>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types<x<0>, x<1>, x<2>, x<2>, x<3>>{}, hana::trait<is_even>),
+        types<x<0>, x<2>, x<2>>{}
+    ));
+
+    // with a function object
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types<>{}, even{}),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types<x<0>>{}, even{}),
+        types<x<0>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types<x<0>, x<1>, x<2>, x<3>>{}, even{}),
+        types<x<0>, x<2>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(types<x<1>, x<2>, x<3>, x<4>, x<5>>{}, even{}),
+        types<x<2>, x<4>>{}
+    ));
+}
@@ -0,0 +1,45 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/flatten.hpp>
+namespace hana = boost::hana;
+using hana::experimental::types;
+
+
+template <int> struct x;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::flatten(types<>{}),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::flatten(types<types<>>{}),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::flatten(types<types<x<0>, x<1>>>{}),
+        types<x<0>, x<1>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::flatten(types<types<x<0>>, types<>, types<x<1>, x<2>>>{}),
+        types<x<0>, x<1>, x<2>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::flatten(types<
+            types<x<0>>, types<x<1>>, types<>, types<x<2>, x<3>>,
+            types<x<4>>, types<>, types<x<5>, x<6>, x<7>>
+        >{}),
+        types<x<0>, x<1>, x<2>, x<3>, x<4>, x<5>, x<6>, x<7>>{}
+    ));
+
+    // flattening only removes one level of nesting
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::flatten(types<types<types<x<0>>>, types<x<1>>>{}),
+        types<types<x<0>>, x<1>>{}
+    ));
+}
@@ -0,0 +1,67 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/type.hpp>
+
+#include <laws/base.hpp>
+namespace hana = boost::hana;
+using hana::experimental::types;
+
+
+template <typename ...>
+struct f { struct type; };
+
+template <int> struct x;
+
+int main() {
+    // with a Metafunction and a type as the state
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::fold_left(types<>{}, hana::type_c<x<0>>, hana::metafunction<f>),
+        hana::type_c<x<0>>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::fold_left(types<x<1>>{}, hana::type_c<x<0>>, hana::metafunction<f>),
+        hana::type_c<f<x<0>, x<1>>::type>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::fold_left(types<x<1>, x<2>, x<3>>{}, hana::type_c<x<0>>, hana::metafunction<f>),
+        hana::type_c<f<f<f<x<0>, x<1>>::type, x<2>>::type, x<3>>::type>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::fold_left(types<x<1>, x<2>, x<3>>{}, hana::type_c<x<0>>, hana::template_<f>),
+        hana::type_c<f<f<f<x<0>, x<1>>, x<2>>, x<3>>>
+    ));
+
+    // with a Metafunction and no state
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::fold_left(types<x<0>>{}, hana::metafunction<f>),
+        hana::type_c<x<0>>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::fold_left(types<x<0>, x<1>, x<2>>{}, hana::metafunction<f>),
+        hana::type_c<f<f<x<0>, x<1>>::type, x<2>>::type>
+    ));
+
+    // with a function object
+    {
+        using hana::test::ct_eq;
+        hana::test::_injection<0> g{};
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::fold_left(types<>{}, ct_eq<0>{}, g),
+            ct_eq<0>{}
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::fold_left(types<x<1>, x<2>>{}, ct_eq<0>{}, g),
+            g(g(ct_eq<0>{}, hana::type_c<x<1>>), hana::type_c<x<2>>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::fold_left(types<x<1>, x<2>>{}, g),
+            g(hana::type_c<x<1>>, hana::type_c<x<2>>)
+        ));
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+namespace hana = boost::hana;
+
+
+template <int> struct x;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(hana::experimental::types<>{}),
+        hana::size_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(hana::experimental::types<x<0>>{}),
+        hana::size_c<1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(hana::experimental::types<x<0>, x<1>>{}),
+        hana::size_c<2>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(hana::experimental::types<x<0>, x<1>, x<0>>{}),
+        hana::size_c<3>
+    ));
+}
@@ -0,0 +1,66 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::experimental::types;
+
+
+template <int i, int tag = 0> struct x;
+
+template <typename T, typename U>
+struct less;
+
+template <int i, int t, int j, int u>
+struct less<x<i, t>, x<j, u>> : std::integral_constant<bool, (i < j)> { };
+
+struct less_fn {
+    template <int i, int t, int j, int u>
+    constexpr auto operator()(hana::basic_type<x<i, t>> const&,
+                              hana::basic_type<x<j, u>> const&) const
+    { return hana::bool_c<(i < j)>; }
+};
+
+int main() {
+    // with a Metafunction
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(types<>{}, hana::trait<less>),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(types<x<0>>{}, hana::trait<less>),
+        types<x<0>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(types<x<1>, x<0>>{}, hana::trait<less>),
+        types<x<0>, x<1>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(types<x<3>, x<0>, x<2>, x<4>, x<1>>{}, hana::trait<less>),
+        types<x<0>, x<1>, x<2>, x<3>, x<4>>{}
+    ));
+
+    // with a function object
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(types<>{}, less_fn{}),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(types<x<2>, x<1>, x<0>>{}, less_fn{}),
+        types<x<0>, x<1>, x<2>>{}
+    ));
+
+    // the sort is stable
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(types<x<1, 0>, x<0, 0>, x<1, 1>, x<0, 1>, x<1, 2>>{}, less_fn{}),
+        types<x<0, 0>, x<0, 1>, x<1, 0>, x<1, 1>, x<1, 2>>{}
+    ));
+}
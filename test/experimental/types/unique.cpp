@@ -0,0 +1,58 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unique.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::experimental::types;
+
+
+template <int i, int tag = 0> struct x;
+
+template <typename T, typename U>
+struct same_value;
+
+template <int i, int t, int j, int u>
+struct same_value<x<i, t>, x<j, u>> : std::integral_constant<bool, i == j> { };
+
+int main() {
+    // without a predicate
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(types<>{}),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(types<x<0>>{}),
+        types<x<0>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(types<x<0>, x<0>>{}),
+        types<x<0>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(types<x<0>, x<1>, x<1>, x<0>, x<0>, x<0>, x<2>>{}),
+        types<x<0>, x<1>, x<0>, x<2>>{}
+    ));
+
+    // with a predicate
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(types<>{}, hana::trait<same_value>),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(types<x<0, 0>, x<0, 1>, x<1, 0>, x<1, 1>, x<0, 2>>{},
+                     hana::trait<same_value>),
+        types<x<0, 0>, x<1, 0>, x<0, 2>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(types<x<0, 0>, x<0, 1>, x<1, 0>>{}, hana::equal),
+        types<x<0, 0>, x<0, 1>, x<1, 0>>{}
+    ));
+}
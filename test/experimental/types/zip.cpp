@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/zip.hpp>
+namespace hana = boost::hana;
+using hana::experimental::types;
+
+
+template <int> struct x;
+template <int> struct y;
+template <int> struct z;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::zip(types<>{}),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::zip(types<>{}, types<>{}),
+        types<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::zip(types<x<0>, x<1>>{}),
+        types<types<x<0>>, types<x<1>>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::zip(types<x<0>, x<1>>{}, types<y<0>, y<1>>{}),
+        types<types<x<0>, y<0>>, types<x<1>, y<1>>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::zip(types<x<0>, x<1>, x<2>>{},
+                  types<y<0>, y<1>, y<2>>{},
+                  types<z<0>, z<1>, z<2>>{}),
+        types<types<x<0>, y<0>, z<0>>,
+              types<x<1>, y<1>, z<1>>,
+              types<x<2>, y<2>, z<2>>>{}
+    ));
+}
@@ -0,0 +1,77 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{});
+        auto product = hana::experimental::cartesian_product_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(product, hana::size_c<0>),
+            hana::make_tuple(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(product, hana::size_c<1>),
+            hana::make_tuple(ct_eq<1>{})
+        ));
+    }
+
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{});
+        auto product = hana::experimental::cartesian_product_view(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(product, hana::size_c<0>),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(product, hana::size_c<2>),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<4>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(product, hana::size_c<4>),
+            hana::make_tuple(ct_eq<1>{}, ct_eq<3>{})
+        ));
+    }
+
+    // the elements are in the same order as with hana::cartesian_product
+    {
+        auto storage1 = hana::make_tuple(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = hana::make_tuple(ct_eq<2>{});
+        auto storage3 = hana::make_tuple(ct_eq<3>{}, ct_eq<4>{}, ct_eq<5>{});
+        auto product = hana::experimental::cartesian_product_view(storage1, storage2, storage3);
+        auto expected = hana::cartesian_product(hana::make_tuple(storage1, storage2, storage3));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(product, hana::size_c<3>),
+            hana::at(expected, hana::size_c<3>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(product, hana::size_c<5>),
+            hana::at(expected, hana::size_c<5>)
+        ));
+    }
+
+    // elements of sequences that are not views are referenced, not copied
+    {
+        hana::tuple<int, char> storage1{1, 'x'};
+        hana::tuple<int, char> storage2{2, 'y'};
+        auto product = hana::experimental::cartesian_product_view(storage1, storage2);
+        hana::at_c<1>(hana::at(product, hana::size_c<1>)) = 'z';
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(storage2) == 'z');
+    }
+}
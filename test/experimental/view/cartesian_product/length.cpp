@@ -0,0 +1,68 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/length.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container();
+        auto product = hana::experimental::cartesian_product_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(product),
+            hana::size_c<0>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(product));
+    }
+
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container();
+        auto product = hana::experimental::cartesian_product_view(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(product),
+            hana::size_c<0>
+        ));
+    }
+
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{});
+        auto product = hana::experimental::cartesian_product_view(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(product),
+            hana::size_c<6>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(product)));
+    }
+
+    // large products are not materialized
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                                 ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{}, ct_eq<7>{});
+        auto product = hana::experimental::cartesian_product_view(
+            storage, storage, storage, storage, storage, storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(product),
+            hana::size_c<262144>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(product, hana::size_c<262143>),
+            hana::make_tuple(ct_eq<7>{}, ct_eq<7>{}, ct_eq<7>{},
+                             ct_eq<7>{}, ct_eq<7>{}, ct_eq<7>{})
+        ));
+    }
+}
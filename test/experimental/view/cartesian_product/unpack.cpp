@@ -0,0 +1,57 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+
+#include <vector>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto product = hana::experimental::cartesian_product_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(product, f),
+            f(hana::make_tuple(ct_eq<0>{}))
+        ));
+    }
+
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{});
+        auto product = hana::experimental::cartesian_product_view(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(product, f),
+            f(hana::make_tuple(ct_eq<0>{}, ct_eq<2>{}),
+              hana::make_tuple(ct_eq<0>{}, ct_eq<3>{}),
+              hana::make_tuple(ct_eq<1>{}, ct_eq<2>{}),
+              hana::make_tuple(ct_eq<1>{}, ct_eq<3>{}))
+        ));
+    }
+
+    // for_each visits the elements in order
+    {
+        hana::tuple<int, int> storage1{1, 2};
+        hana::tuple<int, int, int> storage2{10, 20, 30};
+        auto product = hana::experimental::cartesian_product_view(storage1, storage2);
+        std::vector<int> sums;
+        hana::for_each(product, [&](auto const& xy) {
+            sums.push_back(hana::at_c<0>(xy) + hana::at_c<1>(xy));
+        });
+        BOOST_HANA_RUNTIME_CHECK(sums == std::vector<int>{11, 21, 31, 12, 22, 32});
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/not.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct is_even {
+    template <int i>
+    constexpr auto operator()(ct_eq<i> const&) const
+    { return hana::bool_c<i % 2 == 0>; }
+};
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container();
+        auto filtered = hana::experimental::filtered(storage, is_even{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(filtered),
+            hana::size_c<0>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(filtered));
+    }
+
+    {
+        auto storage = container(ct_eq<1>{});
+        auto filtered = hana::experimental::filtered(storage, is_even{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(filtered),
+            hana::size_c<0>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(filtered));
+    }{
+        auto storage = container(ct_eq<0>{});
+        auto filtered = hana::experimental::filtered(storage, is_even{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(filtered),
+            hana::size_c<1>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(filtered)));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{});
+        auto filtered = hana::experimental::filtered(storage, is_even{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(filtered),
+            hana::size_c<2>
+        ));
+    }
+}
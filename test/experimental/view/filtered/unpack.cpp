@@ -0,0 +1,80 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+struct is_even {
+    template <int i>
+    constexpr auto operator()(ct_eq<i> const&) const
+    { return hana::bool_c<i % 2 == 0>; }
+};
+
+struct shift {
+    template <int i>
+    constexpr ct_eq<i + 1> operator()(ct_eq<i> const&) const
+    { return {}; }
+};
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container();
+        auto filtered = hana::experimental::filtered(storage, is_even{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f()
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto filtered = hana::experimental::filtered(storage, is_even{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<0>{})
+        ));
+    }{
+        auto storage = container(ct_eq<1>{});
+        auto filtered = hana::experimental::filtered(storage, is_even{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f()
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{},
+                                 ct_eq<3>{}, ct_eq<4>{}, ct_eq<5>{});
+        auto filtered = hana::experimental::filtered(storage, is_even{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<0>{}, ct_eq<2>{}, ct_eq<4>{})
+        ));
+    }
+
+    // filtering a transformed view
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto filtered = hana::experimental::filtered(
+            hana::experimental::transformed(storage, shift{}),
+            is_even{}
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(filtered, f),
+            f(ct_eq<2>{})
+        ));
+    }
+}
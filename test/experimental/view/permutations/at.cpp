@@ -0,0 +1,87 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/permutations.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto perms = hana::experimental::permutations_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(perms, hana::size_c<0>),
+            container(ct_eq<0>{})
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto perms = hana::experimental::permutations_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(perms, hana::size_c<0>),
+            container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(perms, hana::size_c<3>),
+            container(ct_eq<1>{}, ct_eq<2>{}, ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(perms, hana::size_c<5>),
+            container(ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }
+
+    // the elements are in the same order as with hana::permutations
+    {
+        auto storage = hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{});
+        auto perms = hana::experimental::permutations_view(storage);
+        auto expected = hana::permutations(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(perms, hana::size_c<7>),
+            hana::at(expected, hana::size_c<7>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(perms, hana::size_c<17>),
+            hana::at(expected, hana::size_c<17>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(perms, hana::size_c<23>),
+            hana::at(expected, hana::size_c<23>)
+        ));
+    }
+
+    // large sequences: only the accessed permutation is computed
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                                 ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{}, ct_eq<7>{},
+                                 ct_eq<8>{}, ct_eq<9>{});
+        auto perms = hana::experimental::permutations_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(perms, hana::size_c<3628799>),
+            container(ct_eq<9>{}, ct_eq<8>{}, ct_eq<7>{}, ct_eq<6>{}, ct_eq<5>{},
+                      ct_eq<4>{}, ct_eq<3>{}, ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }
+
+    // elements of sequences that are not views are referenced, not copied
+    {
+        hana::tuple<int, char> storage{1, 'x'};
+        auto perms = hana::experimental::permutations_view(storage);
+        hana::at_c<0>(hana::at(perms, hana::size_c<1>)) = 'y';
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(storage) == 'y');
+    }
+}
@@ -0,0 +1,53 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+
+#include <vector>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container();
+        auto perms = hana::experimental::permutations_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(perms, f),
+            f(container())
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{});
+        auto perms = hana::experimental::permutations_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(perms, f),
+            f(container(ct_eq<0>{}, ct_eq<1>{}),
+              container(ct_eq<1>{}, ct_eq<0>{}))
+        ));
+    }
+
+    // for_each visits the permutations in order
+    {
+        hana::tuple<int, int, int> storage{1, 2, 3};
+        auto perms = hana::experimental::permutations_view(storage);
+        std::vector<int> values;
+        hana::for_each(perms, [&](auto const& p) {
+            values.push_back(100 * hana::at_c<0>(p) + 10 * hana::at_c<1>(p) + hana::at_c<2>(p));
+        });
+        BOOST_HANA_RUNTIME_CHECK(values == std::vector<int>{123, 132, 213, 231, 312, 321});
+    }
+}
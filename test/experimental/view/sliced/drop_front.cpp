@@ -0,0 +1,63 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <type_traits>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container();
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::drop_front(sliced, hana::size_c<1>),
+            container()
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int, 2, 0, 1>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::drop_front(sliced, hana::size_c<0>),
+            container(ct_eq<2>{}, ct_eq<0>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::drop_front(sliced, hana::size_c<1>),
+            container(ct_eq<0>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::drop_front(sliced, hana::size_c<3>),
+            container()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::drop_front(sliced, hana::size_c<4>),
+            container()
+        ));
+    }
+
+    // the indices of a sliced view are composed instead of nesting views
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int, 2, 0, 1>);
+        auto dropped = hana::drop_front(sliced, hana::size_c<1>);
+        static_assert(std::is_same<
+            decltype(dropped),
+            hana::experimental::sliced_view_t<decltype(storage), 0, 1>
+        >{}, "");
+    }
+}
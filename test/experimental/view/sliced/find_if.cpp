@@ -0,0 +1,47 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container();
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find_if(sliced, hana::equal.to(ct_eq<0>{})),
+            hana::nothing
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int, 2, 1>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find_if(sliced, hana::equal.to(ct_eq<0>{})),
+            hana::nothing
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find_if(sliced, hana::equal.to(ct_eq<1>{})),
+            hana::just(ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::find_if(sliced, hana::equal.to(ct_eq<2>{})),
+            hana::just(ct_eq<2>{})
+        ));
+    }
+}
@@ -0,0 +1,59 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/greater.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_ord;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container();
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(sliced),
+            container()
+        ));
+    }
+
+    {
+        auto storage = container(ct_ord<0>{});
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int, 0>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(sliced),
+            container(ct_ord<0>{})
+        ));
+    }
+
+    {
+        auto storage = container(ct_ord<3>{}, ct_ord<1>{}, ct_ord<2>{}, ct_ord<0>{});
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int, 0, 1, 2>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(sliced),
+            container(ct_ord<1>{}, ct_ord<2>{}, ct_ord<3>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(sliced, hana::greater),
+            container(ct_ord<3>{}, ct_ord<2>{}, ct_ord<1>{})
+        ));
+
+        // sorting only reorders the indices of the view
+        static_assert(std::is_same<
+            decltype(hana::sort(sliced)),
+            hana::experimental::sliced_view_t<decltype(storage), 1, 2, 0>
+        >{}, "");
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/take_front.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container();
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::take_front(sliced, hana::size_c<0>),
+            container()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::take_front(sliced, hana::size_c<1>),
+            container()
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto sliced = hana::experimental::sliced(storage, hana::tuple_c<int, 2, 0, 1>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::take_front(sliced, hana::size_c<0>),
+            container()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::take_front(sliced, hana::size_c<1>),
+            container(ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::take_front(sliced, hana::size_c<2>),
+            container(ct_eq<2>{}, ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::take_front(sliced, hana::size_c<4>),
+            container(ct_eq<2>{}, ct_eq<0>{}, ct_eq<1>{})
+        ));
+    }
+
+    // works on any view, not only sliced views
+    {
+        auto f = hana::test::_injection<0>{};
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto transformed = hana::experimental::transformed(storage, f);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::take_front(transformed, hana::size_c<2>),
+            container(f(ct_eq<0>{}), f(ct_eq<1>{}))
+        ));
+    }
+}
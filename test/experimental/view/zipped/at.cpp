@@ -0,0 +1,63 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto zipped = hana::experimental::zipped(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(zipped, hana::size_c<0>),
+            hana::make_tuple(ct_eq<0>{})
+        ));
+    }
+
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{});
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(zipped, hana::size_c<0>),
+            hana::make_tuple(ct_eq<0>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(zipped, hana::size_c<1>),
+            hana::make_tuple(ct_eq<1>{}, ct_eq<3>{})
+        ));
+    }
+
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{});
+        auto storage3 = container(ct_eq<4>{}, ct_eq<5>{});
+        auto zipped = hana::experimental::zipped(storage1, storage2, storage3);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at(zipped, hana::size_c<1>),
+            hana::make_tuple(ct_eq<1>{}, ct_eq<3>{}, ct_eq<5>{})
+        ));
+    }
+
+    // elements of sequences that are not views are referenced, not copied
+    {
+        hana::tuple<int, char> storage1{1, 'x'};
+        hana::tuple<int, char> storage2{2, 'y'};
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        hana::at_c<1>(hana::at(zipped, hana::size_c<0>)) = 3;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(storage2) == 3);
+    }
+}
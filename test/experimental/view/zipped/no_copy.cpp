@@ -0,0 +1,79 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+namespace hana = boost::hana;
+
+
+// Make sure that a chain of views can be consumed by fold_left, for_each
+// and unpack without ever copying nor moving the underlying elements.
+template <int i>
+struct NoCopy {
+    int value;
+    NoCopy() : value{i} { }
+    NoCopy(NoCopy const&) = delete;
+    NoCopy(NoCopy&&) = delete;
+};
+
+struct keep_even {
+    template <int i>
+    constexpr auto operator()(NoCopy<i> const&) const
+    { return hana::bool_c<i % 2 == 0>; }
+};
+
+struct get_ref {
+    template <int i>
+    NoCopy<i>& operator()(NoCopy<i>& x) const { return x; }
+};
+
+int main() {
+    hana::tuple<NoCopy<0>, NoCopy<1>, NoCopy<2>, NoCopy<3>> xs;
+    hana::tuple<int, int> ys{10, 20};
+
+    auto zipped = hana::experimental::zipped(
+        hana::experimental::transformed(
+            hana::experimental::filtered(xs, keep_even{}),
+            get_ref{}
+        ),
+        ys
+    );
+
+    // fold_left
+    {
+        int sum = hana::fold_left(zipped, 0, [](int state, auto row) {
+            return state + hana::at_c<0>(row).value * hana::at_c<1>(row);
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 0 * 10 + 2 * 20);
+    }
+
+    // for_each, modifying the underlying elements in place
+    {
+        hana::for_each(zipped, [](auto row) {
+            hana::at_c<0>(row).value += hana::at_c<1>(row);
+        });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(xs).value == 10);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs).value == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(xs).value == 22);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<3>(xs).value == 3);
+    }
+
+    // unpack
+    {
+        int sum = hana::unpack(zipped, [](auto ...row) {
+            int result = 0;
+            int values[] = {0, (hana::at_c<0>(row).value)...};
+            for (int v : values)
+                result += v;
+            return result;
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 10 + 22);
+    }
+}
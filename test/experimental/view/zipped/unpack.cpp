@@ -0,0 +1,58 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage1 = container();
+        auto storage2 = container();
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, f),
+            f()
+        ));
+    }
+
+    {
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{});
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, f),
+            f(hana::make_tuple(ct_eq<0>{}, ct_eq<2>{}),
+              hana::make_tuple(ct_eq<1>{}, ct_eq<3>{}))
+        ));
+    }
+
+    // zipping views
+    {
+        auto g = hana::test::_injection<1>{};
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto storage2 = container(ct_eq<3>{}, ct_eq<4>{});
+        auto zipped = hana::experimental::zipped(
+            hana::experimental::transformed(storage1, g),
+            hana::experimental::sliced(storage2, hana::tuple_c<int, 1, 0, 1>)
+        );
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(zipped, f),
+            f(hana::make_tuple(g(ct_eq<0>{}), ct_eq<4>{}),
+              hana::make_tuple(g(ct_eq<1>{}), ct_eq<3>{}),
+              hana::make_tuple(g(ct_eq<2>{}), ct_eq<4>{}))
+        ));
+    }
+}
@@ -14,12 +14,31 @@
 #include <laws/searchable.hpp>
 
 #include <array>
+#include <string>
+#include <type_traits>
 using namespace boost::hana;
 
 
 template <int ...i>
 constexpr auto array() { return std::array<int, sizeof...(i)>{{i...}}; }
 
+struct minus_ {
+    constexpr int operator()(int x, int y) const { return x - y; }
+};
+
+// an accumulator that can't be assigned to, which the loops can't use
+struct Acc { int const v; };
+
+struct add_acc {
+    constexpr Acc operator()(Acc s, int x) const { return Acc{s.v + x}; }
+    constexpr Acc operator()(int x, Acc s) const { return Acc{x + s.v}; }
+    constexpr Acc operator()(Acc x, Acc y) const { return Acc{x.v + y.v}; }
+};
+
+struct is_odd {
+    constexpr bool operator()(int x) const { return x % 2 != 0; }
+};
+
 using test::ct_eq;
 
 int main() {
@@ -122,5 +141,113 @@ int main() {
 
         test::TestSearchable<ext::std::array_tag>{eq_arrays, eq_keys};
     }
+
+#elif BOOST_HANA_TEST_PART == 6
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            transform(array<>(), negate),
+            array<>()
+        ));
+        BOOST_HANA_CONSTEXPR_CHECK(equal(
+            transform(array<0, 1, 2>(), negate),
+            array<0, -1, -2>()
+        ));
+
+        // the result holds the decayed return type of the function
+        std::array<std::string, 2> strings{{"a", "b"}};
+        auto copies = transform(strings, [](std::string const& s) -> std::string const& {
+            return s;
+        });
+        static_assert(std::is_same<
+            decltype(copies), std::array<std::string, 2>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(copies == strings);
+    }
+
+#elif BOOST_HANA_TEST_PART == 7
+    //////////////////////////////////////////////////////////////////////////
+    // Loops used when the accumulator or the predicate has a fixed type
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // fold_left and fold_right
+        {
+            BOOST_HANA_CONSTEXPR_CHECK(fold_left(array<1, 2, 3, 4>(), 0, minus_{}) == -10);
+            BOOST_HANA_CONSTEXPR_CHECK(fold_left(array<1, 2, 3, 4>(), minus_{}) == -8);
+            BOOST_HANA_CONSTEXPR_CHECK(fold_right(array<1, 2, 3, 4>(), 0, minus_{}) == -2);
+            BOOST_HANA_CONSTEXPR_CHECK(fold_right(array<1, 2, 3, 4>(), minus_{}) == -2);
+
+            BOOST_HANA_CONSTEXPR_CHECK(fold_left(array<1>(), 0, minus_{}) == -1);
+            BOOST_HANA_CONSTEXPR_CHECK(fold_left(array<1, 2>(), minus_{}) == -1);
+            BOOST_HANA_CONSTEXPR_CHECK(fold_right(array<1>(), 0, minus_{}) == 1);
+            BOOST_HANA_CONSTEXPR_CHECK(fold_right(array<1, 2>(), minus_{}) == -1);
+
+            std::array<std::string, 3> strings{{"a", "b", "c"}};
+            auto concat_left = [](std::string s, std::string const& x) { return s + x; };
+            auto concat_right = [](std::string const& x, std::string s) { return x + s; };
+            BOOST_HANA_RUNTIME_CHECK(fold_left(strings, std::string{">"}, concat_left) == ">abc");
+            BOOST_HANA_RUNTIME_CHECK(fold_left(strings, concat_left) == "abc");
+            BOOST_HANA_RUNTIME_CHECK(fold_right(strings, std::string{"<"}, concat_right) == "abc<");
+            BOOST_HANA_RUNTIME_CHECK(fold_right(strings, concat_right) == "abc");
+
+            // the generic fold is used when the accumulator changes type
+            auto tuple = fold_left(array<1, 2, 3>(), make_tuple(), append);
+            BOOST_HANA_RUNTIME_CHECK(equal(tuple, make_tuple(1, 2, 3)));
+
+            // and when the accumulator can't be assigned to
+            BOOST_HANA_CONSTEXPR_CHECK(fold_left(array<1, 2, 3>(), Acc{0}, add_acc{}).v == 6);
+            BOOST_HANA_CONSTEXPR_CHECK(fold_right(array<1, 2, 3>(), Acc{0}, add_acc{}).v == 6);
+            std::array<Acc, 3> accs{{Acc{1}, Acc{2}, Acc{3}}};
+            BOOST_HANA_RUNTIME_CHECK(fold_left(accs, add_acc{}).v == 6);
+            BOOST_HANA_RUNTIME_CHECK(fold_right(accs, add_acc{}).v == 6);
+        }
+
+        // for_each
+        {
+            std::array<int, 3> xs{{1, 2, 3}};
+            int total = 0;
+            for_each(xs, [&](int& x) { total = total * 10 + x; x = 0; });
+            BOOST_HANA_RUNTIME_CHECK(total == 123);
+            BOOST_HANA_RUNTIME_CHECK(xs == array<0, 0, 0>());
+        }
+
+        // count_if and sum
+        {
+            BOOST_HANA_CONSTEXPR_CHECK(count_if(array<1, 2, 3, 5>(), is_odd{}) == 3);
+            BOOST_HANA_CONSTEXPR_CHECK(count_if(array<2, 4>(), is_odd{}) == 0);
+            BOOST_HANA_CONSTANT_CHECK(equal(count_if(array<>(), is_odd{}), size_c<0>));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(array<1, 2, 3>(), always(true_c)),
+                size_c<3>
+            ));
+
+            BOOST_HANA_CONSTEXPR_CHECK(sum<>(array<1, 2, 3, 4>()) == 10);
+            BOOST_HANA_CONSTEXPR_CHECK(sum<>(array<1>()) == 1);
+            BOOST_HANA_CONSTANT_CHECK(equal(sum<>(array<>()), int_c<0>));
+        }
+
+        // any_of and all_of
+        {
+            BOOST_HANA_CONSTEXPR_CHECK(any_of(array<2, 3, 4>(), is_odd{}));
+            BOOST_HANA_CONSTEXPR_CHECK(!any_of(array<2, 4>(), is_odd{}));
+            BOOST_HANA_CONSTEXPR_CHECK(all_of(array<1, 3, 5>(), is_odd{}));
+            BOOST_HANA_CONSTEXPR_CHECK(!all_of(array<1, 2, 3>(), is_odd{}));
+            BOOST_HANA_CONSTANT_CHECK(not_(any_of(array<>(), is_odd{})));
+            BOOST_HANA_CONSTANT_CHECK(all_of(array<>(), is_odd{}));
+
+            BOOST_HANA_CONSTANT_CHECK(any_of(array<1, 2>(), always(true_c)));
+            BOOST_HANA_CONSTANT_CHECK(not_(all_of(array<1, 2>(), always(false_c))));
+
+            // the loop stops at the first element satisfying the predicate
+            int calls = 0;
+            BOOST_HANA_RUNTIME_CHECK(any_of(array<1, 2, 3>(), [&](int x) {
+                ++calls;
+                return x == 2;
+            }));
+            BOOST_HANA_RUNTIME_CHECK(calls == 2);
+        }
+    }
 #endif
 }
@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/integer_sequence.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = std::integer_sequence<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(ints<>{}, ints<>{}),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(ints<1>{}, ints<>{}),
+        ints<1>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(ints<>{}, ints<1>{}),
+        ints<1>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(ints<1, 2>{}, ints<3, 4>{}),
+        ints<1, 2, 3, 4>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::concat(std::integer_sequence<char, 1>{}, std::integer_sequence<long, 2>{}),
+        std::integer_sequence<long, 1, 2>{}
+    ));
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/integer_sequence.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = std::integer_sequence<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(ints<>{}, hana::int_c<0>)));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(ints<0>{}, hana::int_c<0>));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(ints<3, -1, 8>{}, hana::int_c<8>));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(ints<3, -1, 8>{}, hana::long_c<-1>));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(ints<3, -1, 8>{}, hana::int_c<2>)));
+
+    // with a value that is not an IntegralConstant
+    BOOST_HANA_RUNTIME_CHECK(hana::contains(ints<3, -1, 8>{}, 8));
+    BOOST_HANA_RUNTIME_CHECK(!hana::contains(ints<3, -1, 8>{}, 2));
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/integer_sequence.hpp>
+#include <boost/hana/ext/std/integral_constant.hpp>
+#include <boost/hana/maximum.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = std::integer_sequence<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::maximum(ints<3>{}),
+        std::integral_constant<int, 3>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::maximum(ints<3, -1, 8, 2>{}),
+        std::integral_constant<int, 8>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::maximum(ints<8, 8, -1>{}),
+        std::integral_constant<int, 8>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::maximum(std::index_sequence<0, 4, 2>{}),
+        std::integral_constant<std::size_t, 4>{}
+    ));
+}
@@ -0,0 +1,45 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/integer_sequence.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/sum.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = std::integer_sequence<int, v...>;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<>(ints<>{}),
+        hana::int_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<>(ints<3>{}),
+        hana::int_c<3>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<>(ints<3, -1, 8>{}),
+        hana::int_c<3 - 1 + 8>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<hana::integral_constant_tag<long>>(ints<3, -1, 8>{}),
+        hana::long_c<3 - 1 + 8>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<>(std::index_sequence<1, 2, 3>{}),
+        hana::size_c<6>
+    ));
+
+    // with a Monoid other than an IntegralConstant
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<hana::integral_constant_tag<int>>(std::integer_sequence<char, 1, 2>{}),
+        hana::int_c<3>
+    ));
+}
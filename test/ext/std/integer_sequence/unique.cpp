@@ -0,0 +1,51 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/integer_sequence.hpp>
+#include <boost/hana/unique.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <int ...v>
+using ints = std::integer_sequence<int, v...>;
+
+struct same_parity {
+    template <typename X, typename Y>
+    constexpr auto operator()(X const&, Y const&) const
+    { return hana::bool_c<(X::value % 2 == Y::value % 2)>; }
+};
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<>{}),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<1>{}),
+        ints<1>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<1, 1>{}),
+        ints<1>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<1, 1, 2, 1, 3, 3, 3>{}),
+        ints<1, 2, 1, 3>{}
+    ));
+
+    // with a predicate
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<>{}, same_parity{}),
+        ints<>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unique(ints<1, 3, 2, 4, 6, 5>{}, same_parity{}),
+        ints<1, 2, 5>{}
+    ));
+}
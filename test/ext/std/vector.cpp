@@ -5,6 +5,16 @@
 #include <boost/hana/ext/std/vector.hpp>
 
 #include <boost/hana/assert.hpp>
+#include <boost/hana/count_if.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/fold_right.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/functional/compose.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/sum.hpp>
+#include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 
 #include <laws/base.hpp>
@@ -12,10 +22,42 @@
 // #include <laws/functor.hpp>
 #include <laws/orderable.hpp>
 
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 using namespace boost::hana;
 
 
+static int allocations = 0;
+
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <typename U>
+    counting_allocator(counting_allocator<U> const&) { }
+
+    T* allocate(std::size_t n) {
+        ++allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    { std::allocator<T>{}.deallocate(p, n); }
+
+    template <typename U>
+    bool operator==(counting_allocator<U> const&) const { return true; }
+    template <typename U>
+    bool operator!=(counting_allocator<U> const&) const { return false; }
+};
+
+struct move_only {
+    std::unique_ptr<int> p;
+};
+
 int main() {
     auto eqs = make_tuple(
           std::vector<test::eq<0>>{0}
@@ -41,4 +83,102 @@ int main() {
     test::TestComparable<ext::std::vector_tag>{eqs};
     test::TestOrderable<ext::std::vector_tag>{ords};
     // test::TestFunctor<ext::std::vector_tag>{eqs, eq_values};
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // identity and composition
+        {
+            std::vector<int> ints{1, 2, 3};
+            auto f = [](int i) { return i * 2; };
+            auto g = [](int i) { return std::to_string(i); };
+            BOOST_HANA_RUNTIME_CHECK(transform(ints, id) == ints);
+            BOOST_HANA_RUNTIME_CHECK(
+                transform(ints, compose(g, f)) == transform(transform(ints, f), g)
+            );
+            BOOST_HANA_RUNTIME_CHECK(transform(std::vector<int>{}, g).empty());
+        }
+
+        // the result uses the allocator of the input and allocates once
+        {
+            std::vector<int, counting_allocator<int>> ints{1, 2, 3, 4};
+            allocations = 0;
+            auto strings = transform(ints, [](int i) { return std::to_string(i); });
+            static_assert(std::is_same<
+                decltype(strings),
+                std::vector<std::string, counting_allocator<std::string>>
+            >{}, "");
+            BOOST_HANA_RUNTIME_CHECK(allocations == 1);
+            BOOST_HANA_RUNTIME_CHECK(strings[0] == "1" && strings[3] == "4");
+        }
+
+        // an rvalue is modified in place when the element type is unchanged
+        {
+            std::vector<int, counting_allocator<int>> ints{1, 2, 3};
+            int const* data = ints.data();
+            allocations = 0;
+            auto doubled = transform(std::move(ints), [](int i) { return i * 2; });
+            BOOST_HANA_RUNTIME_CHECK(allocations == 0);
+            BOOST_HANA_RUNTIME_CHECK(doubled.data() == data);
+            BOOST_HANA_RUNTIME_CHECK((doubled == std::vector<int, counting_allocator<int>>{2, 4, 6}));
+        }
+
+        // the elements of an rvalue are moved into the function
+        {
+            std::vector<move_only> xs;
+            xs.push_back(move_only{std::make_unique<int>(1)});
+            xs.push_back(move_only{std::make_unique<int>(2)});
+            auto ps = transform(std::move(xs), [](move_only x) { return std::move(x.p); });
+            BOOST_HANA_RUNTIME_CHECK(*ps[0] == 1 && *ps[1] == 2);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::vector<std::string> strings{"a", "b", "c"};
+        auto concat_left = [](std::string s, std::string const& x) { return s + x; };
+        auto concat_right = [](std::string const& x, std::string s) { return x + s; };
+
+        // fold_left and fold_right
+        {
+            BOOST_HANA_RUNTIME_CHECK(fold_left(strings, std::string{">"}, concat_left) == ">abc");
+            BOOST_HANA_RUNTIME_CHECK(fold_left(strings, concat_left) == "abc");
+            BOOST_HANA_RUNTIME_CHECK(fold_right(strings, std::string{"<"}, concat_right) == "abc<");
+            BOOST_HANA_RUNTIME_CHECK(fold_right(strings, concat_right) == "abc");
+
+            std::vector<std::string> empty{};
+            BOOST_HANA_RUNTIME_CHECK(fold_left(empty, ">", concat_left) == ">");
+            BOOST_HANA_RUNTIME_CHECK(fold_right(empty, "<", concat_right) == "<");
+
+            // the accumulator takes the type returned by the function
+            std::vector<int> ints{1, 2, 3, 4};
+            BOOST_HANA_RUNTIME_CHECK(fold_left(ints, int_c<0>, plus) == 10);
+            BOOST_HANA_RUNTIME_CHECK(sum<>(ints) == 10);
+            BOOST_HANA_RUNTIME_CHECK(sum<>(std::vector<int>{}) == 0);
+        }
+
+        // for_each
+        {
+            std::string all;
+            for_each(strings, [&](std::string const& s) { all += s; });
+            BOOST_HANA_RUNTIME_CHECK(all == "abc");
+
+            std::vector<std::string> moved;
+            for_each(std::move(strings), [&](std::string&& s) {
+                moved.push_back(std::move(s));
+            });
+            BOOST_HANA_RUNTIME_CHECK((moved == std::vector<std::string>{"a", "b", "c"}));
+        }
+
+        // count_if
+        {
+            std::vector<int> ints{1, 2, 3, 5};
+            auto is_odd = [](int i) { return i % 2 != 0; };
+            BOOST_HANA_RUNTIME_CHECK(count_if(ints, is_odd) == 3);
+            BOOST_HANA_RUNTIME_CHECK(count_if(std::vector<int>{}, is_odd) == 0);
+        }
+    }
 }
@@ -3,8 +3,10 @@
 // (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
 
 #include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/erase_key.hpp>
+#include <boost/hana/insert.hpp>
 #include <boost/hana/map.hpp>
 
 #include <laws/base.hpp>
@@ -67,4 +69,18 @@ int main() {
         hana::erase_key(hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()), key<3>()),
         hana::make_map(p<1, 1>(), p<2, 2>())
     ));
+
+    // erase_key followed by other operations on the same map
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(hana::erase_key(hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()), key<1>()), p<1, 4>()),
+        hana::make_map(p<1, 4>(), p<2, 2>(), p<3, 3>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_key(hana::erase_key(hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()), key<1>()), key<3>()),
+        val<3>()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::erase_key(hana::erase_key(hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()), key<2>()), key<3>()),
+        hana::make_map(p<1, 1>())
+    ));
 }
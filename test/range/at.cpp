@@ -33,4 +33,14 @@ int main() {
         hana::at(hana::make_range(hana::int_c<4>, hana::int_c<90>), hana::int_c<46>),
         hana::int_c<50>
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at(hana::make_range(hana::int_c<4>, hana::int_c<90>, hana::int_c<3>), hana::int_c<5>),
+        hana::int_c<19>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at(hana::make_range(hana::int_c<4>, hana::int_c<-90>, hana::int_c<-3>), hana::int_c<5>),
+        hana::int_c<-11>
+    ));
 }
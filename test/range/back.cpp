@@ -28,4 +28,14 @@ int main() {
         hana::back(hana::make_range(hana::int_c<3>, hana::int_c<6>)),
         hana::int_c<5>
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::back(hana::make_range(hana::int_c<3>, hana::int_c<10>, hana::int_c<3>)),
+        hana::int_c<9>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::back(hana::make_range(hana::int_c<3>, hana::int_c<-10>, hana::int_c<-4>)),
+        hana::int_c<-9>
+    ));
 }
@@ -53,4 +53,22 @@ int main() {
         hana::make_range(hana::int_c<0>, hana::int_c<10>),
         cnumeric<int, 15>
     )));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(
+        hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>),
+        cnumeric<int, 4>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(
+        hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>),
+        cnumeric<int, 5>
+    )));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(
+        hana::make_range(hana::int_c<9>, hana::int_c<-9>, hana::int_c<-4>),
+        cnumeric<int, 1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(
+        hana::make_range(hana::int_c<9>, hana::int_c<-9>, hana::int_c<-4>),
+        cnumeric<int, -11>
+    )));
 }
@@ -0,0 +1,65 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/drop_back.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/range.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(hana::make_range(hana::int_c<0>, hana::int_c<0>), hana::size_c<0>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(hana::make_range(hana::int_c<0>, hana::int_c<0>), hana::size_c<2>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(hana::make_range(hana::int_c<0>, hana::int_c<3>), hana::size_c<0>),
+        hana::make_range(hana::int_c<0>, hana::int_c<3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(hana::make_range(hana::int_c<0>, hana::int_c<3>), hana::size_c<1>),
+        hana::make_range(hana::int_c<0>, hana::int_c<2>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(hana::make_range(hana::int_c<0>, hana::int_c<3>), hana::size_c<3>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(hana::make_range(hana::int_c<0>, hana::int_c<3>), hana::size_c<5>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(hana::make_range(hana::int_c<0>, hana::int_c<20>, hana::int_c<3>), hana::size_c<2>),
+        hana::make_range(hana::int_c<0>, hana::int_c<15>, hana::int_c<3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_back(hana::make_range(hana::int_c<5>, hana::int_c<-5>, hana::int_c<-2>), hana::size_c<1>),
+        hana::make_range(hana::int_c<5>, hana::int_c<-3>, hana::int_c<-2>)
+    ));
+
+    // the length of the result is kept even when stepping past the last
+    // value would wrap around beyond the first one
+    {
+        auto r = hana::range_c<unsigned char, 0, 255, 50>;
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(hana::drop_back(r, hana::size_c<0>)),
+            hana::size_c<6>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::drop_back(r, hana::size_c<0>), r));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::drop_back(r, hana::size_c<1>),
+            hana::range_c<unsigned char, 0, 201, 50>
+        ));
+    }
+}
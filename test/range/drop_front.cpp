@@ -72,4 +72,14 @@ int main() {
         hana::drop_front(hana::make_range(hana::int_c<20>, hana::int_c<50>), hana::int_c<10>),
         hana::make_range(hana::int_c<30>, hana::int_c<50>)
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_front(hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>), hana::int_c<2>),
+        hana::make_range(hana::int_c<7>, hana::int_c<10>, hana::int_c<3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::drop_front(hana::make_range(hana::int_c<1>, hana::int_c<-6>, hana::int_c<-3>), hana::int_c<5>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
 }
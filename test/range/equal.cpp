@@ -6,6 +6,7 @@
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
 #include <boost/hana/not_equal.hpp> // for operator !=
 #include <boost/hana/range.hpp>
 namespace hana = boost::hana;
@@ -62,4 +63,26 @@ int main() {
         hana::make_range(hana::int_c<-4>, hana::int_c<2>),
         hana::make_range(hana::int_c<-4>, hana::int_c<2>)
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::make_range(hana::int_c<0>, hana::int_c<10>, hana::int_c<3>),
+        hana::make_range(hana::int_c<0>, hana::int_c<12>, hana::int_c<3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        hana::make_range(hana::int_c<0>, hana::int_c<10>, hana::int_c<3>),
+        hana::make_range(hana::int_c<0>, hana::int_c<10>, hana::int_c<2>)
+    )));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::make_range(hana::int_c<4>, hana::int_c<5>, hana::int_c<3>),
+        hana::make_range(hana::int_c<4>, hana::int_c<0>, hana::int_c<-7>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::make_range(hana::int_c<0>, hana::int_c<0>, hana::int_c<3>),
+        hana::make_range(hana::int_c<4>, hana::int_c<4>, hana::int_c<-1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::make_range(hana::int_c<2>, hana::int_c<5>),
+        hana::make_range(hana::int_c<2>, hana::int_c<5>, hana::int_c<1>)
+    ));
 }
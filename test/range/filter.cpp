@@ -0,0 +1,69 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+namespace hana = boost::hana;
+
+
+template <int m, int r>
+struct mod_equal {
+    template <typename N>
+    constexpr auto operator()(N const&) const
+    { return hana::bool_c<(N::value % m + m) % m == r>; }
+};
+
+struct always_false {
+    template <typename N>
+    constexpr auto operator()(N const&) const
+    { return hana::false_c; }
+};
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<0>, hana::int_c<0>), mod_equal<2, 0>{}),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<0>, hana::int_c<10>), always_false{}),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<0>, hana::int_c<10>), mod_equal<1, 0>{}),
+        hana::make_range(hana::int_c<0>, hana::int_c<10>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<0>, hana::int_c<10>), mod_equal<2, 0>{}),
+        hana::make_range(hana::int_c<0>, hana::int_c<10>, hana::int_c<2>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<0>, hana::int_c<10>), mod_equal<3, 1>{}),
+        hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<0>, hana::int_c<10>), mod_equal<7, 3>{}),
+        hana::make_range(hana::int_c<3>, hana::int_c<4>)
+    ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<-9>, hana::int_c<9>, hana::int_c<3>), mod_equal<2, 0>{}),
+        hana::make_range(hana::int_c<-6>, hana::int_c<9>, hana::int_c<6>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<20>, hana::int_c<0>, hana::int_c<-1>), mod_equal<5, 0>{}),
+        hana::make_range(hana::int_c<20>, hana::int_c<0>, hana::int_c<-5>)
+    ));
+
+    // large ranges are filtered in linear time
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::filter(hana::make_range(hana::int_c<0>, hana::int_c<3000>), mod_equal<3, 1>{}),
+        hana::make_range(hana::int_c<1>, hana::int_c<3000>, hana::int_c<3>)
+    ));
+}
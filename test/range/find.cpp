@@ -54,4 +54,26 @@ int main() {
         hana::find(hana::make_range(hana::int_c<0>, hana::int_c<10>), cnumeric<int, 15>),
         hana::nothing
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>), cnumeric<int, 7>),
+        hana::just(hana::int_c<7>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>), cnumeric<int, 6>),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>), cnumeric<int, 10>),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(hana::make_range(hana::int_c<9>, hana::int_c<-9>, hana::int_c<-4>), cnumeric<int, -7>),
+        hana::just(hana::int_c<-7>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(hana::make_range(hana::int_c<9>, hana::int_c<-9>, hana::int_c<-4>), cnumeric<int, 13>),
+        hana::nothing
+    ));
 }
@@ -23,4 +23,13 @@ int main() {
     BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(
         hana::make_range(hana::int_c<0>, hana::int_c<2>)
     )));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::is_empty(
+        hana::make_range(hana::int_c<3>, hana::int_c<3>, hana::int_c<-2>)
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(
+        hana::make_range(hana::int_c<3>, hana::int_c<2>, hana::int_c<-2>)
+    )));
 }
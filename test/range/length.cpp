@@ -32,4 +32,22 @@ int main() {
         hana::length(hana::make_range(hana::int_c<4>, hana::int_c<10>)),
         hana::size_c<6>
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(hana::make_range(hana::int_c<0>, hana::int_c<10>, hana::int_c<3>)),
+        hana::size_c<4>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(hana::make_range(hana::int_c<0>, hana::int_c<9>, hana::int_c<3>)),
+        hana::size_c<3>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(hana::make_range(hana::int_c<5>, hana::int_c<-5>, hana::int_c<-2>)),
+        hana::size_c<5>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::length(hana::range_c<unsigned char, 255, 0, -100>),
+        hana::size_c<3>
+    ));
 }
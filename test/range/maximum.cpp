@@ -24,4 +24,14 @@ int main() {
         hana::maximum(hana::make_range(hana::int_c<-1>, hana::int_c<6>)),
         hana::int_c<5>
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::maximum(hana::make_range(hana::int_c<-1>, hana::int_c<10>, hana::int_c<3>)),
+        hana::int_c<8>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::maximum(hana::make_range(hana::int_c<10>, hana::int_c<-1>, hana::int_c<-3>)),
+        hana::int_c<10>
+    ));
 }
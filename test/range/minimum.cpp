@@ -24,4 +24,14 @@ int main() {
         hana::minimum(hana::make_range(hana::int_c<-1>, hana::int_c<5>)),
         hana::int_c<-1>
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::minimum(hana::make_range(hana::int_c<-1>, hana::int_c<10>, hana::int_c<3>)),
+        hana::int_c<-1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::minimum(hana::make_range(hana::int_c<10>, hana::int_c<-1>, hana::int_c<-3>)),
+        hana::int_c<1>
+    ));
 }
@@ -37,4 +37,14 @@ int main() {
         hana::range_c<T, 1, 3>,
         hana::make_range(hana::integral_c<T, 1>, hana::integral_c<T, 3>)
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::range_c<T, 1, 7, 2>,
+        hana::make_range(hana::integral_c<T, 1>, hana::integral_c<T, 7>, hana::int_c<2>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::range_c<T, 7, 1, -2>,
+        hana::make_range(hana::integral_c<T, 7>, hana::integral_c<T, 1>, hana::int_c<-2>)
+    ));
 }
@@ -0,0 +1,87 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+int main() {
+    hana::test::_injection<0> f{};
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(hana::make_range(hana::int_c<0>, hana::int_c<0>)),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(hana::make_range(hana::int_c<0>, hana::int_c<1>)),
+        hana::make_range(hana::int_c<0>, hana::int_c<1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(hana::make_range(hana::int_c<0>, hana::int_c<3>)),
+        hana::make_range(hana::int_c<2>, hana::int_c<-1>, hana::int_c<-1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(hana::reverse(hana::make_range(hana::int_c<0>, hana::int_c<3>)), f),
+        f(hana::int_c<2>, hana::int_c<1>, hana::int_c<0>)
+    ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>)),
+        hana::make_range(hana::int_c<7>, hana::int_c<0>, hana::int_c<-3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(hana::make_range(hana::int_c<10>, hana::int_c<0>, hana::int_c<-4>)),
+        hana::make_range(hana::int_c<2>, hana::int_c<11>, hana::int_c<4>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(hana::reverse(hana::make_range(hana::int_c<-5>, hana::int_c<6>, hana::int_c<2>))),
+        hana::make_range(hana::int_c<-5>, hana::int_c<6>, hana::int_c<2>)
+    ));
+
+    // reversing a range of unsigned values starting at 0 must work even
+    // though its end can't be represented without wrapping around
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(hana::reverse(hana::range_c<std::size_t, 0, 3>), f),
+        f(hana::size_c<2>, hana::size_c<1>, hana::size_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::reverse(hana::reverse(hana::range_c<std::size_t, 0, 3>)),
+        hana::range_c<std::size_t, 0, 3>
+    ));
+
+    // the length of the result is kept even when stepping past the last
+    // value would wrap around beyond the first one
+    {
+        auto r = hana::range_c<unsigned char, 0, 255, 50>;
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(hana::reverse(r)),
+            hana::size_c<6>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(hana::reverse(r), f),
+            f(hana::integral_c<unsigned char, 250>, hana::integral_c<unsigned char, 200>,
+              hana::integral_c<unsigned char, 150>, hana::integral_c<unsigned char, 100>,
+              hana::integral_c<unsigned char, 50>, hana::integral_c<unsigned char, 0>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::reverse(hana::reverse(r)), r));
+
+        auto big = hana::range_c<int, 0, 10, (1LL << 40)>;
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(hana::reverse(big), f),
+            f(hana::int_c<0>)
+        ));
+    }
+}
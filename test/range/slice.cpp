@@ -0,0 +1,55 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/slice.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+int main() {
+    hana::test::_injection<0> f{};
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice(hana::make_range(hana::int_c<0>, hana::int_c<5>),
+                    hana::range_c<std::size_t, 0, 0>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice(hana::make_range(hana::int_c<0>, hana::int_c<5>),
+                    hana::range_c<std::size_t, 1, 4>),
+        hana::make_range(hana::int_c<1>, hana::int_c<4>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice_c<2, 5>(hana::make_range(hana::int_c<10>, hana::int_c<20>)),
+        hana::make_range(hana::int_c<12>, hana::int_c<15>)
+    ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::slice(hana::make_range(hana::int_c<0>, hana::int_c<30>, hana::int_c<3>),
+                    hana::range_c<std::size_t, 1, 8, 2>),
+        hana::make_range(hana::int_c<3>, hana::int_c<27>, hana::int_c<6>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(hana::slice(hana::make_range(hana::int_c<0>, hana::int_c<30>, hana::int_c<3>),
+                                 hana::range_c<std::size_t, 1, 8, 2>), f),
+        f(hana::int_c<3>, hana::int_c<9>, hana::int_c<15>, hana::int_c<21>)
+    ));
+
+    // reversed indices
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(hana::slice(hana::make_range(hana::int_c<10>, hana::int_c<15>),
+                                 hana::range_c<std::ptrdiff_t, 4, -1, -2>), f),
+        f(hana::int_c<14>, hana::int_c<12>, hana::int_c<10>)
+    ));
+}
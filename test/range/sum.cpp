@@ -82,4 +82,18 @@ int main() {
         hana::sum<>(hana::make_range(hana::int_c<3>, hana::int_c<7>)),
         hana::int_c<3 + 4 + 5 + 6>
     ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<>(hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>)),
+        hana::int_c<1 + 4 + 7>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<>(hana::make_range(hana::int_c<1>, hana::int_c<11>, hana::int_c<3>)),
+        hana::int_c<1 + 4 + 7 + 10>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sum<>(hana::make_range(hana::int_c<7>, hana::int_c<-7>, hana::int_c<-3>)),
+        hana::int_c<7 + 4 + 1 + -2 + -5>
+    ));
 }
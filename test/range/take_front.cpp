@@ -0,0 +1,68 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/take_front.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(hana::make_range(hana::int_c<0>, hana::int_c<0>), hana::size_c<0>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(hana::make_range(hana::int_c<0>, hana::int_c<0>), hana::size_c<2>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(hana::make_range(hana::int_c<0>, hana::int_c<3>), hana::size_c<0>),
+        hana::make_range(hana::int_c<0>, hana::int_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(hana::make_range(hana::int_c<0>, hana::int_c<3>), hana::size_c<2>),
+        hana::make_range(hana::int_c<0>, hana::int_c<2>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(hana::make_range(hana::int_c<0>, hana::int_c<3>), hana::size_c<3>),
+        hana::make_range(hana::int_c<0>, hana::int_c<3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(hana::make_range(hana::int_c<0>, hana::int_c<3>), hana::size_c<5>),
+        hana::make_range(hana::int_c<0>, hana::int_c<3>)
+    ));
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(hana::make_range(hana::int_c<0>, hana::int_c<20>, hana::int_c<3>), hana::size_c<4>),
+        hana::make_range(hana::int_c<0>, hana::int_c<10>, hana::int_c<3>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::take_front(hana::make_range(hana::int_c<5>, hana::int_c<-5>, hana::int_c<-2>), hana::size_c<2>),
+        hana::make_range(hana::int_c<5>, hana::int_c<2>, hana::int_c<-2>)
+    ));
+
+    // the length of the result is kept even when stepping past the last
+    // value would wrap around beyond the first one
+    {
+        auto r = hana::range_c<unsigned char, 0, 255, 50>;
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(hana::take_front(r, hana::size_c<6>)),
+            hana::size_c<6>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::take_front(r, hana::size_c<6>), r));
+
+        auto big = hana::range_c<int, 0, 10, (1LL << 40)>;
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(hana::take_front(big, hana::size_c<1>)),
+            hana::size_c<1>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::take_front(big, hana::size_c<1>), big));
+    }
+}
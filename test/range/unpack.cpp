@@ -42,4 +42,14 @@ int main() {
         using T = hana::tag_of_t<decltype(x)>;
         static_assert(std::is_same<typename T::value_type, int>{}, "");
     });
+
+    // with a step
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(hana::make_range(hana::int_c<1>, hana::int_c<10>, hana::int_c<3>), f),
+        f(hana::int_c<1>, hana::int_c<4>, hana::int_c<7>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::unpack(hana::make_range(hana::int_c<1>, hana::int_c<-6>, hana::int_c<-3>), f),
+        f(hana::int_c<1>, hana::int_c<-2>, hana::int_c<-5>)
+    ));
 }
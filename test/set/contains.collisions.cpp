@@ -0,0 +1,109 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/difference.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/intersection.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/union.hpp>
+namespace hana = boost::hana;
+
+
+// This test makes sure that sets behave properly when the hashes of
+// distinct elements collide.
+
+template <int i>
+struct K { };
+
+struct the_hash;
+
+namespace boost { namespace hana {
+    template <int i>
+    struct hash_impl<K<i>> {
+        static constexpr auto apply(K<i> const&)
+        { return hana::type_c<the_hash>; }
+    };
+}}
+
+template <int i, int j>
+constexpr auto operator==(K<i> const&, K<j> const&)
+{ return hana::bool_c<i == j>; }
+
+template <int i, int j>
+constexpr auto operator!=(K<i> const&, K<j> const&)
+{ return hana::bool_c<i != j>; }
+
+int main() {
+    // ensure the hashes actually collide
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::hash(K<0>{}), hana::hash(K<1>{})));
+
+    // make_set
+    {
+        auto set = hana::make_set(K<0>{}, K<1>{}, K<2>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, K<0>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, K<1>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, K<2>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(set, K<3>{})));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::find(set, K<1>{}), hana::just(K<1>{})));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::find(set, K<3>{}), hana::nothing));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(set, K<2>{}), K<2>{}));
+    }
+
+    // insert
+    {
+        auto set = hana::insert(hana::make_set(K<0>{}), K<1>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(set, hana::make_set(K<0>{}, K<1>{})));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::insert(set, K<0>{}), set));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::insert(set, K<1>{}), set));
+    }
+
+    // erase_key
+    {
+        auto set = hana::make_set(K<0>{}, K<1>{}, K<2>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::erase_key(set, K<1>{}),
+            hana::make_set(K<0>{}, K<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(hana::erase_key(set, K<1>{}), K<2>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::erase_key(set, K<3>{}), set));
+
+        auto erased = hana::erase_key(hana::erase_key(set, K<0>{}), K<2>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(erased, hana::make_set(K<1>{})));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::find(erased, K<1>{}), hana::just(K<1>{})));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::insert(erased, K<0>{}),
+            hana::make_set(K<0>{}, K<1>{})
+        ));
+    }
+
+    // union_, intersection and difference
+    {
+        auto xs = hana::make_set(K<0>{}, K<1>{});
+        auto ys = hana::make_set(K<1>{}, K<2>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::union_(xs, ys),
+            hana::make_set(K<0>{}, K<1>{}, K<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::intersection(xs, ys),
+            hana::make_set(K<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::difference(xs, ys),
+            hana::make_set(K<0>{})
+        ));
+    }
+}